@@ -6,10 +6,12 @@
 
 #include <zephyr/dt-bindings/value/adc.h>
 #include <zephyr/drivers/value.h>
+#include <zephyr/drivers/value_workq.h>
 #include <zephyr/drivers/adc.h>
 #include <zephyr/kernel.h>
 #include <zephyr/device.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/atomic.h>
 
 #define DT_DRV_COMPAT ADC_VALUES_DT_COMPAT
 
@@ -17,13 +19,87 @@ LOG_MODULE_REGISTER(adc_values, CONFIG_ADC_VALUES_LOG_LEVEL);
 
 #define ADC_VALUES_FLAG_BYTES ((CONFIG_ADC_VALUES_MAX_CHANNELS + 7) / 8)
 
+struct adc_values_group {
+	/* pointer to device (needed for callback) */
+	const struct device *dev;
+	/* ADC device which converts group */
+	const struct device *adc;
+	/* sequence to convert channels of group */
+	struct adc_sequence sequence;
+	struct adc_sequence_options options;
+	/* index of the first channel of group in channels order */
+	uint8_t first;
+	/* number of channels in group */
+	uint8_t num_channels;
+	/* software averaging of 2^n samplings (0 when not used) */
+	uint8_t average;
+	/* the next group of the same ADC (ADC_VALUES_NO_GROUP when last) */
+	uint8_t next;
+	/* the first group of ADC */
+	bool head;
+};
+
+#define ADC_VALUES_NO_GROUP UINT8_MAX
+
+#define ADC_VALUES_NO_CHANNEL UINT8_MAX
+
+#define ADC_VALUES_EDGE_RISING BIT(0)
+#define ADC_VALUES_EDGE_FALLING BIT(1)
+
 struct adc_values_data {
 	bool active;
-	uint8_t channel;
-	struct adc_sequence sequence;
+	uint8_t num_groups;
+	/* number of ADC devices used */
+	uint8_t num_lanes;
+	/* number of ADC devices which still converts current scan */
+	atomic_t lanes;
+	/* groups which conversion is done but not handled by thread */
+	ATOMIC_DEFINE(done, CONFIG_ADC_VALUES_MAX_CHANNELS);
+	/* groups which conversion is started but not done */
+	ATOMIC_DEFINE(busy, CONFIG_ADC_VALUES_MAX_CHANNELS);
+	/* groups which conversion is not signalled yet (ADC is locked) */
+	ATOMIC_DEFINE(pending, CONFIG_ADC_VALUES_MAX_CHANNELS);
+	const struct device *dev;
 	struct k_work work;
-	uint8_t ready[ADC_VALUES_FLAG_BYTES];
-	uint8_t fault[ADC_VALUES_FLAG_BYTES];
+	/* stream is running (until callback sees inactive state) */
+	atomic_t streaming;
+	/* number of filled halves of stream buffer */
+	atomic_t stream_blocks;
+	/* number of filled halves seen by thread */
+	uint32_t stream_handled;
+	/* number of halves overwritten before processed */
+	uint32_t stream_lost;
+	/* sampling in current half of stream buffer */
+	uint16_t stream_pos;
+	/* position of the next sampling in ring */
+	uint16_t ring_head;
+	/* number of streamed samplings */
+	uint32_t samplings;
+	/* start time of current scan (in cycles) */
+	uint32_t scan_start;
+	/* duration of the last scan (in nanoseconds) */
+	uint32_t scan_time;
+	/* state of capture (ADC_VALUES_CAPTURE_*) */
+	atomic_t capture_state;
+	/* trigger requested by value */
+	atomic_t capture_request;
+	struct value_sub_cb capture_cb;
+	/* position of the next scan in capture buffer */
+	uint16_t capture_head;
+	/* number of captured scans */
+	uint16_t capture_count;
+	/* number of scans to capture after trigger */
+	uint16_t capture_post;
+	/* index of trigger scan in snapshot */
+	uint16_t capture_trigger;
+	/* raw sample of trigger channel in previous scan */
+	uint16_t capture_last;
+	ATOMIC_DEFINE(ready, CONFIG_ADC_VALUES_MAX_CHANNELS);
+	ATOMIC_DEFINE(fault, CONFIG_ADC_VALUES_MAX_CHANNELS);
+	/* lazy channels which raw samples is not converted yet */
+	ATOMIC_DEFINE(dirty, CONFIG_ADC_VALUES_MAX_CHANNELS);
+	/* channels which configuration is loaded before each conversion */
+	uint8_t conflicts[ADC_VALUES_FLAG_BYTES];
 	value_t values[];
 };
 
@@ -37,101 +113,788 @@ static inline void set_flag(uint8_t *data, unsigned bit)
 	data[bit / 8] |= 1 << (bit % 8);
 }
 
-static inline void reset_flags(uint8_t *data)
+/* set flags of channels at once */
+static void set_flags(atomic_t *flags, const uint8_t *chns, size_t num)
+{
+	atomic_val_t masks[ATOMIC_BITMAP_SIZE(CONFIG_ADC_VALUES_MAX_CHANNELS)] = { 0 };
+	size_t idx;
+
+	for (idx = 0; idx < num; idx++) {
+		masks[chns[idx] / ATOMIC_BITS] |= ATOMIC_MASK(chns[idx]);
+	}
+
+	for (idx = 0; idx < ARRAY_SIZE(masks); idx++) {
+		if (masks[idx] != 0) {
+			atomic_or(&flags[idx], masks[idx]);
+		}
+	}
+}
+
+static inline void reset_flags(atomic_t *flags)
 {
-	memset(data, 0, ADC_VALUES_FLAG_BYTES);
+	size_t idx;
+
+	for (idx = 0; idx < ATOMIC_BITMAP_SIZE(CONFIG_ADC_VALUES_MAX_CHANNELS); idx++) {
+		atomic_clear(&flags[idx]);
+	}
 }
 
+struct adc_values_calibration {
+	/* pairs of raw sample and value sorted by raw sample */
+	const int32_t *points;
+	uint16_t num_points;
+	/* raw samples of points are evenly spaced */
+	bool uniform;
+};
+
 struct adc_values_config {
 	const struct adc_dt_spec *channel_specs;
 	value_t (*convert)(value_id_t id, uint16_t raw);
+	/* groups of channels converted by single sequence */
+	struct adc_values_group *groups;
+	/* channels in order of samples */
+	uint8_t *order;
+	/* oversampling of channels (0 to use ADC channel settings) */
+	const uint8_t *oversampling;
+	/* channels converted on demand */
+	const bool *lazy;
+	/* raw samples of channels (converted on demand for lazy ones) */
+	uint16_t *raws;
+	/* samples of all channels */
+	uint16_t *samples;
 	uint8_t num_channels;
+	/* ping-pong buffer of samplings (NULL when not streaming) */
+	uint16_t *stream;
+	/* ring of raw samples of channels */
+	uint16_t *ring;
+	/* interval between samplings in streaming mode */
+	uint32_t stream_interval;
+	/* number of samplings in half of stream buffer */
+	uint16_t stream_block;
+	/* number of samplings in ring */
+	uint16_t ring_size;
+	/* ring of raw samples of scans (NULL when not capturing) */
+	uint16_t *capture;
+	/* value which triggers capture (NULL when not used) */
+	const struct value_dt_spec *capture_spec;
+	/* number of scans in capture buffer */
+	uint16_t capture_size;
+	/* number of scans to keep before trigger */
+	uint16_t capture_pre;
+	/* threshold of trigger channel (raw sample) */
+	uint16_t capture_threshold;
+	/* trigger channel (ADC_VALUES_NO_CHANNEL when not used) */
+	uint8_t capture_channel;
+	/* trigger edges (ADC_VALUES_EDGE_*) */
+	uint8_t capture_edge;
+	/* convert channels of the same ADC in single sequence */
+	bool scan;
+	/* convert samples in ADC callback */
+	bool isr_convert;
 };
 
-static void adc_values_task(const struct device *dev, bool cont)
+/*
+ * Find the channels which share ADC channel with different configuration.
+ * The others are configured once on initialization.
+ */
+static void adc_values_conflicts_init(const struct device *dev)
 {
 	const struct adc_values_config *cfg = dev->config;
 	struct adc_values_data *data = dev->data;
-	unsigned count;
-	int rc;
+	const struct adc_dt_spec *spec;
+	const struct adc_dt_spec *other;
+	unsigned i, j;
 
-	for (count = 0; count < cfg->num_channels; count++) {
-		if (cont) {
-			// convert sample to value
-			data->values[data->channel] =
-				cfg->convert(data->channel, *(uint16_t *)data->sequence.buffer);
-
-			set_flag(data->ready, data->channel);
+	for (i = 0; i < cfg->num_channels; i++) {
+		spec = &cfg->channel_specs[i];
+		if (spec->dev == NULL) {
+			continue;
+		}
 
-			if (data->channel < cfg->num_channels - 1) {
-				// select next channel
-				data->channel++;
-			} else {
-				break;
+		for (j = 0; j < i; j++) {
+			other = &cfg->channel_specs[j];
+			if (other->dev == spec->dev && other->channel_id == spec->channel_id &&
+			    memcmp(&other->channel_cfg, &spec->channel_cfg,
+				   sizeof(spec->channel_cfg))) {
+				set_flag(data->conflicts, i);
+				set_flag(data->conflicts, j);
 			}
-		} else {
-			data->channel = 0;
 		}
+	}
+}
+
+/* check that hardware oversampling of group can be replaced by averaging */
+static inline bool adc_values_can_average(const struct device *dev,
+					  const struct adc_values_group *group)
+{
+	const struct adc_values_config *cfg = dev->config;
+
+	return cfg->stream == NULL && group->average == 0 &&
+	       group->sequence.oversampling != 0 &&
+	       cfg->oversampling[cfg->order[group->first]] != 0;
+}
 
-		// configure channel
-		rc = adc_channel_setup_dt(&cfg->channel_specs[data->channel]);
+/* convert 2^n samplings in single sequence and average it instead of oversampling */
+static void adc_values_group_average(const struct device *dev, struct adc_values_group *group)
+{
+	const struct adc_values_config *cfg = dev->config;
+	uint8_t oversampling = cfg->oversampling[cfg->order[group->first]];
+
+	group->average = oversampling;
+	group->sequence.oversampling = 0;
+	group->options.extra_samplings = BIT(oversampling) - 1;
+	group->sequence.buffer_size = (group->num_channels << oversampling) *
+				      sizeof(cfg->samples[0]);
+}
+
+static int adc_values_group_start(const struct device *dev, struct adc_values_group *group)
+{
+	const struct adc_values_config *cfg = dev->config;
+	struct adc_values_data *data = dev->data;
+	const uint8_t *chn = &cfg->order[group->first];
+	const uint8_t *chn_end = &cfg->order[group->first + group->num_channels];
+	int rc;
+
+	// configure channels which share ADC channel with others
+	for (; chn < chn_end; chn++) {
+		if (!is_flag(data->conflicts, *chn)) {
+			continue;
+		}
+
+		rc = adc_channel_setup_dt(&cfg->channel_specs[*chn]);
 		if (rc) {
 			LOG_ERR("%s: Error when setup ADC channel: #%u",
-				dev->name, data->channel);
+				dev->name, *chn);
 			goto err;
 		}
+	}
 
-		// configure sequence
-		rc = adc_sequence_init_dt(&cfg->channel_specs[data->channel],
-					  &data->sequence);
-		if (rc) {
-			LOG_ERR("%s: Error when init ADC sequence: #%u",
-				dev->name, data->channel);
-			goto err;
+	// mark before start because callback may be called meanwhile
+	if (cfg->stream == NULL) {
+		atomic_set_bit(data->busy, group - cfg->groups);
+		atomic_set_bit(data->pending, group - cfg->groups);
+	}
+
+	// start conversion
+	rc = adc_read_async(group->adc, &group->sequence, NULL);
+	// other errors (for ex. -EINVAL) is not related to oversampling
+	if (rc == -ENOTSUP && adc_values_can_average(dev, group)) {
+		LOG_WRN("%s: Oversampling is not supported by ADC, use averaging: #%u",
+			dev->name, cfg->order[group->first]);
+
+		adc_values_group_average(dev, group);
+
+		rc = adc_read_async(group->adc, &group->sequence, NULL);
+	}
+	if (rc) {
+		LOG_ERR("%s: Error when start conversion: #%u",
+			dev->name, cfg->order[group->first]);
+		atomic_clear_bit(data->busy, group - cfg->groups);
+		atomic_clear_bit(data->pending, group - cfg->groups);
+		goto err;
+	}
+
+	return 0;
+
+err:
+	set_flags(data->fault, &cfg->order[group->first], group->num_channels);
+
+	return rc;
+}
+
+static void adc_values_group_done(const struct device *dev, const struct adc_values_group *group,
+				  const uint16_t *samples)
+{
+	const struct adc_values_config *cfg = dev->config;
+	struct adc_values_data *data = dev->data;
+	const uint16_t *sample = samples;
+	const uint16_t *sample_end = &samples[group->num_channels << group->average];
+	uint32_t sums[CONFIG_ADC_VALUES_MAX_CHANNELS];
+	uint16_t raw;
+	unsigned idx;
+	uint8_t chn;
+
+	if (group->average > 0) {
+		memset(sums, 0, group->num_channels * sizeof(sums[0]));
+
+		// sum samplings in single pass over buffer
+		for (idx = 0; sample < sample_end; sample++) {
+			sums[idx] += *sample;
+
+			if (++idx == group->num_channels) {
+				idx = 0;
+			}
 		}
+	}
 
-		// start conversion
-		rc = adc_read_async(cfg->channel_specs[data->channel].dev,
-				    &data->sequence, NULL);
-		if (rc) {
-			LOG_ERR("%s: Error when start conversion: #%u",
-				dev->name, data->channel);
-			goto err;
+	for (idx = 0; idx < group->num_channels; idx++) {
+		chn = cfg->order[group->first + idx];
+
+		raw = group->average > 0 ?
+		      (sums[idx] + BIT(group->average - 1)) >> group->average :
+		      samples[idx];
+
+		cfg->raws[chn] = raw;
+
+		if (cfg->lazy[chn]) {
+			// convert raw sample on demand
+			atomic_set_bit(data->dirty, chn);
+		} else {
+			// convert sample to value
+			data->values[chn] = cfg->convert(chn, raw);
 		}
+	}
 
-		break;
+	set_flags(data->ready, &cfg->order[group->first], group->num_channels);
+}
 
-err:
-		set_flag(data->fault, data->channel);
-		continue;
+/* check trigger channel crossed threshold since previous scan */
+static bool adc_values_capture_crossed(const struct device *dev)
+{
+	const struct adc_values_config *cfg = dev->config;
+	struct adc_values_data *data = dev->data;
+	uint16_t last = data->capture_last;
+	uint16_t raw = cfg->raws[cfg->capture_channel];
+
+	data->capture_last = raw;
+
+	if (data->capture_count < 2) {
+		// no previous scan
+		return false;
 	}
+
+	return ((cfg->capture_edge & ADC_VALUES_EDGE_RISING) &&
+		last < cfg->capture_threshold && raw >= cfg->capture_threshold) ||
+	       ((cfg->capture_edge & ADC_VALUES_EDGE_FALLING) &&
+		last >= cfg->capture_threshold && raw < cfg->capture_threshold);
 }
 
+/* record raw samples of scan to capture buffer */
+static void adc_values_capture(const struct device *dev)
+{
+	const struct adc_values_config *cfg = dev->config;
+	struct adc_values_data *data = dev->data;
+	atomic_val_t state = atomic_get(&data->capture_state);
+	bool trigger;
+
+	if (state != ADC_VALUES_CAPTURE_ARMED && state != ADC_VALUES_CAPTURE_TRIGGERED) {
+		return;
+	}
+
+	memcpy(&cfg->capture[data->capture_head * cfg->num_channels], cfg->raws,
+	       cfg->num_channels * sizeof(cfg->raws[0]));
+
+	if (++data->capture_head == cfg->capture_size) {
+		data->capture_head = 0;
+	}
+
+	if (data->capture_count < cfg->capture_size) {
+		data->capture_count++;
+	}
+
+	if (state == ADC_VALUES_CAPTURE_ARMED) {
+		trigger = atomic_clear(&data->capture_request) != 0;
+
+		if (cfg->capture_channel != ADC_VALUES_NO_CHANNEL) {
+			trigger = adc_values_capture_crossed(dev) || trigger;
+		}
+
+		if (!trigger) {
+			return;
+		}
+
+		// keep pre-trigger scans only
+		data->capture_count = MIN(data->capture_count, cfg->capture_pre + 1);
+		data->capture_trigger = data->capture_count - 1;
+		data->capture_post = cfg->capture_size - cfg->capture_pre - 1;
+
+		if (!atomic_cas(&data->capture_state, ADC_VALUES_CAPTURE_ARMED,
+				ADC_VALUES_CAPTURE_TRIGGERED)) {
+			// stopped meanwhile
+			return;
+		}
+	} else {
+		data->capture_post--;
+	}
+
+	if (data->capture_post == 0) {
+		// freeze snapshot
+		atomic_cas(&data->capture_state, ADC_VALUES_CAPTURE_TRIGGERED,
+			   ADC_VALUES_CAPTURE_FROZEN);
+	}
+}
+
+static void adc_values_capture_cb(struct value_sub_cb *cb, const struct device *dev,
+				  value_id_t id)
+{
+	struct adc_values_data *data = CONTAINER_OF(cb, struct adc_values_data, capture_cb);
+
+	atomic_set(&data->capture_request, 1);
+}
+
+static inline void adc_values_scan_done(const struct device *dev)
+{
+	const struct adc_values_config *cfg = dev->config;
+	struct adc_values_data *data = dev->data;
+
+	data->scan_time = k_cyc_to_ns_floor32(k_cycle_get_32() - data->scan_start);
+
+	if (cfg->capture != NULL) {
+		adc_values_capture(dev);
+	}
+}
+
+/* start conversion of the first group of ADC which can be started */
+static bool adc_values_lane_start(const struct device *dev, uint8_t idx)
+{
+	const struct adc_values_config *cfg = dev->config;
+	struct adc_values_data *data = dev->data;
+
+	for (; idx < data->num_groups; idx = cfg->groups[idx].next) {
+		if (adc_values_group_start(dev, &cfg->groups[idx]) == 0) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void adc_values_lane_done(const struct device *dev)
+{
+	struct adc_values_data *data = dev->data;
+
+	if (atomic_dec(&data->lanes) == 1) {
+		// all ADC devices are done
+		adc_values_scan_done(dev);
+	}
+}
+
+/* fault channels of group and the following groups of ADC */
+static void adc_values_lane_fault(const struct device *dev, uint8_t idx)
+{
+	const struct adc_values_config *cfg = dev->config;
+	struct adc_values_data *data = dev->data;
+	const struct adc_values_group *group;
+
+	for (; idx != ADC_VALUES_NO_GROUP; idx = group->next) {
+		group = &cfg->groups[idx];
+		set_flags(data->fault, &cfg->order[group->first], group->num_channels);
+	}
+}
+
+/* check that conversion of ADC is not signalled yet, so ADC is still locked */
+static bool adc_values_lane_locked(const struct device *dev, uint8_t idx)
+{
+	const struct adc_values_config *cfg = dev->config;
+	struct adc_values_data *data = dev->data;
+
+	for (; idx != ADC_VALUES_NO_GROUP; idx = cfg->groups[idx].next) {
+		if (atomic_test_bit(data->pending, idx)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* forget current scan (the late callbacks of it is ignored) */
+static void adc_values_scan_reset(const struct device *dev)
+{
+	struct adc_values_data *data = dev->data;
+
+	reset_flags(data->busy);
+	reset_flags(data->done);
+	atomic_clear(&data->lanes);
+}
+
+/* fault channels of stalled conversions and the following groups of ADC */
+static void adc_values_scan_abort(const struct device *dev)
+{
+	const struct adc_values_config *cfg = dev->config;
+	struct adc_values_data *data = dev->data;
+	uint8_t idx;
+
+	for (idx = 0; idx < data->num_groups; idx++) {
+		if (!atomic_test_bit(data->busy, idx)) {
+			continue;
+		}
+
+		LOG_WRN("%s: Conversion is stalled: #%u", dev->name,
+			cfg->order[cfg->groups[idx].first]);
+
+		adc_values_lane_fault(dev, idx);
+	}
+
+	adc_values_scan_reset(dev);
+}
+
+/* start conversion on all ADC devices in parallel */
+static void adc_values_task(const struct device *dev)
+{
+	const struct adc_values_config *cfg = dev->config;
+	struct adc_values_data *data = dev->data;
+	uint8_t idx;
+
+	if (atomic_get(&data->lanes) > 0) {
+		// the failed conversion is not reported by callback
+		if (k_cyc_to_ms_floor32(k_cycle_get_32() - data->scan_start) <
+		    CONFIG_ADC_VALUES_SCAN_TIMEOUT) {
+			LOG_DBG("%s: Previous scan is in progress", dev->name);
+			return;
+		}
+
+		adc_values_scan_abort(dev);
+	}
+
+	data->scan_start = k_cycle_get_32();
+	atomic_set(&data->lanes, data->num_lanes);
+
+	for (idx = 0; idx < data->num_groups; idx++) {
+		if (!cfg->groups[idx].head) {
+			continue;
+		}
+
+		if (adc_values_lane_locked(dev, idx)) {
+			// starting conversion would block until stalled one is signalled
+			adc_values_lane_fault(dev, idx);
+			adc_values_lane_done(dev);
+		} else if (!adc_values_lane_start(dev, idx)) {
+			adc_values_lane_done(dev);
+		}
+	}
+}
+
+/* handle conversions done and start the next ones */
+static void adc_values_task_cont(const struct device *dev)
+{
+	const struct adc_values_config *cfg = dev->config;
+	struct adc_values_data *data = dev->data;
+	const struct adc_values_group *group;
+	uint8_t idx;
+
+	for (idx = 0; idx < data->num_groups; idx++) {
+		if (!atomic_test_and_clear_bit(data->done, idx)) {
+			continue;
+		}
+
+		group = &cfg->groups[idx];
+
+		if (!cfg->isr_convert) {
+			adc_values_group_done(dev, group, group->sequence.buffer);
+		}
+
+		if (!adc_values_lane_start(dev, group->next)) {
+			adc_values_lane_done(dev);
+		}
+	}
+}
+
+/* process filled half of stream buffer */
+static void adc_values_stream_done(const struct device *dev)
+{
+	const struct adc_values_config *cfg = dev->config;
+	struct adc_values_data *data = dev->data;
+	const struct adc_values_group *group = &cfg->groups[0];
+	uint32_t blocks = atomic_get(&data->stream_blocks);
+	const uint16_t *block;
+	const uint16_t *sampling;
+	unsigned pos;
+	unsigned idx;
+
+	if (blocks < data->stream_handled) {
+		// restarted meanwhile
+		data->stream_handled = 0;
+	}
+
+	if (blocks == data->stream_handled) {
+		// nothing new
+		return;
+	}
+
+	// the earlier halves are overwritten already when thread is late
+	data->stream_lost += blocks - data->stream_handled - 1;
+	data->stream_handled = blocks;
+
+	// the latest filled half (the other one is being filled)
+	block = &cfg->stream[((blocks - 1) & 1) * cfg->stream_block * group->num_channels];
+	sampling = block;
+
+	// keep raw samples in ring
+	for (pos = 0; cfg->ring != NULL && pos < cfg->stream_block; pos++) {
+		for (idx = 0; idx < group->num_channels; idx++) {
+			cfg->ring[data->ring_head * cfg->num_channels +
+				  cfg->order[group->first + idx]] = sampling[idx];
+		}
+
+		sampling += group->num_channels;
+
+		if (++data->ring_head == cfg->ring_size) {
+			data->ring_head = 0;
+		}
+	}
+
+	data->samplings += cfg->stream_block;
+
+	// publish the latest sampling of block
+	adc_values_group_done(dev, group, &block[(cfg->stream_block - 1) * group->num_channels]);
+
+	if (cfg->capture != NULL) {
+		adc_values_capture(dev);
+	}
+
+	if (atomic_get(&data->stream_blocks) != blocks) {
+		// the half was being overwritten while processed
+		data->stream_lost++;
+	}
+}
+
+static int adc_values_stream_start(const struct device *dev);
+
 static void adc_values_work_handler(struct k_work *work)
 {
 	struct adc_values_data *data = CONTAINER_OF(work, struct adc_values_data, work);
-	const struct device *dev = data->sequence.options->user_data;
+	const struct adc_values_config *cfg = data->dev->config;
+
+	if (cfg->stream != NULL) {
+		adc_values_stream_done(data->dev);
+
+		if (data->active) {
+			// restart when activated while stopping
+			adc_values_stream_start(data->dev);
+		}
+	} else {
+		adc_values_task_cont(data->dev);
+	}
+}
+
+static enum adc_action adc_values_stream_callback(const struct device *adc_dev,
+						  const struct adc_sequence *sequence,
+						  uint16_t sampling_index)
+{
+	const struct adc_values_group *group = sequence->options->user_data;
+	const struct adc_values_config *cfg = group->dev->config;
+	struct adc_values_data *data = group->dev->data;
+	uint16_t *sampling;
 
-	adc_values_task(dev, true);
+	if (!data->active) {
+		// stop streaming
+		atomic_clear(&data->streaming);
+
+		if (data->active) {
+			// activated meanwhile, restart in thread when ADC is unlocked
+			value_work_submit(&data->work);
+		}
+
+		return ADC_ACTION_FINISH;
+	}
+
+	// copy sampling to the current half of stream buffer
+	sampling = &cfg->stream[((atomic_get(&data->stream_blocks) & 1) * cfg->stream_block +
+				 data->stream_pos) * group->num_channels];
+	memcpy(sampling, sequence->buffer, group->num_channels * sizeof(*sampling));
+
+	if (++data->stream_pos == cfg->stream_block) {
+		// pass filled half to thread and continue with the other one
+		data->stream_pos = 0;
+		atomic_inc(&data->stream_blocks);
+
+		value_work_submit(&data->work);
+	}
+
+	// repeat sampling into the same buffer, so streaming never ends
+	return ADC_ACTION_REPEAT;
+}
+
+static int adc_values_stream_start(const struct device *dev)
+{
+	const struct adc_values_config *cfg = dev->config;
+	struct adc_values_data *data = dev->data;
+	int rc;
+
+	if (!atomic_cas(&data->streaming, 0, 1)) {
+		// still running (the stop is not completed), keep it
+		return 0;
+	}
+
+	data->stream_pos = 0;
+	atomic_clear(&data->stream_blocks);
+
+	rc = adc_values_group_start(dev, &cfg->groups[0]);
+	if (rc < 0) {
+		atomic_clear(&data->streaming);
+	}
+
+	return rc;
 }
 
 static enum adc_action adc_values_sequence_callback(const struct device *adc_dev,
 						    const struct adc_sequence *sequence,
 						    uint16_t sampling_index)
 {
-	const struct device *dev = sequence->options->user_data;
+	const struct adc_values_group *group = sequence->options->user_data;
+	const struct device *dev = group->dev;
+	const struct adc_values_config *cfg = dev->config;
 	struct adc_values_data *data = dev->data;
 
-	k_work_submit(&data->work);
+	if (sampling_index < sequence->options->extra_samplings) {
+		// wait for all samplings to average
+		return ADC_ACTION_CONTINUE;
+	}
+
+	atomic_clear_bit(data->pending, group - cfg->groups);
+
+	if (!atomic_test_and_clear_bit(data->busy, group - cfg->groups)) {
+		// scan was aborted or reset meanwhile
+		return ADC_ACTION_FINISH;
+	}
+
+	if (cfg->isr_convert) {
+		adc_values_group_done(dev, group, group->sequence.buffer);
+
+		if (group->next == ADC_VALUES_NO_GROUP) {
+			// the whole ADC is done without thread
+			adc_values_lane_done(dev);
+			return ADC_ACTION_FINISH;
+		}
+	}
+
+	// the next sequence can be started only in thread
+	// because ADC is locked until this callback returns
+	atomic_set_bit(data->done, group - cfg->groups);
+	value_work_submit(&data->work);
 
 	return ADC_ACTION_FINISH;
 }
 
+static inline bool adc_values_is_channel(const struct device *dev, value_id_t id)
+{
+	const struct adc_values_config *cfg = dev->config;
+
+	return (id & ADC_VALUES_CHANNEL_FLAG) &&
+	       ADC_VALUES_CHANNEL_GET(id) < cfg->num_channels;
+}
+
+static inline int adc_values_channel_get(const struct device *dev, unsigned chn, value_t *pval)
+{
+	const struct adc_values_config *cfg = dev->config;
+	struct adc_values_data *data = dev->data;
+
+	if (atomic_test_and_clear_bit(data->dirty, chn)) {
+		// convert the new sample once
+		data->values[chn] = cfg->convert(chn, cfg->raws[chn]);
+	}
+
+	*pval = data->values[chn];
+
+	if (atomic_test_bit(data->fault, chn)) {
+		return -EFAULT;
+	}
+	if (!atomic_test_bit(data->ready, chn)) {
+		return -EAGAIN;
+	}
+
+	return 0;
+}
+
+static int adc_values_ring_get(const struct device *dev, value_id_t id, value_t *pval)
+{
+	const struct adc_values_config *cfg = dev->config;
+	struct adc_values_data *data = dev->data;
+	unsigned chn = ADC_VALUES_RING_CHANNEL(id);
+	unsigned age = ADC_VALUES_RING_AGE(id);
+	unsigned pos;
+
+	if (chn >= cfg->num_channels || age >= cfg->ring_size) {
+		return -EINVAL;
+	}
+
+	if (age >= data->samplings) {
+		// not sampled yet
+		return -EAGAIN;
+	}
+
+	pos = (data->ring_head + cfg->ring_size - 1 - age) % cfg->ring_size;
+
+	*pval = cfg->ring[pos * cfg->num_channels + chn];
+
+	return 0;
+}
+
+static inline bool adc_values_is_capture(value_id_t id)
+{
+	return id == ADC_VALUES_CAPTURE_STATE ||
+	       id == ADC_VALUES_CAPTURE_TRIGGER ||
+	       id == ADC_VALUES_CAPTURE_LENGTH ||
+	       ADC_VALUES_IS_CAPTURE(id);
+}
+
+static int adc_values_capture_get(const struct device *dev, value_id_t id, value_t *pval)
+{
+	const struct adc_values_config *cfg = dev->config;
+	struct adc_values_data *data = dev->data;
+	unsigned chn = ADC_VALUES_CAPTURE_CHANNEL(id);
+	unsigned idx = ADC_VALUES_CAPTURE_INDEX(id);
+	bool frozen = atomic_get(&data->capture_state) == ADC_VALUES_CAPTURE_FROZEN;
+	unsigned pos;
+
+	switch (id) {
+	case ADC_VALUES_CAPTURE_STATE:
+		*pval = atomic_get(&data->capture_state);
+		return 0;
+
+	case ADC_VALUES_CAPTURE_TRIGGER:
+		*pval = data->capture_trigger;
+		break;
+
+	case ADC_VALUES_CAPTURE_LENGTH:
+		*pval = data->capture_count;
+		break;
+
+	default:
+		if (chn >= cfg->num_channels || idx >= cfg->capture_size) {
+			return -EINVAL;
+		}
+
+		if (!frozen || idx >= data->capture_count) {
+			return -EAGAIN;
+		}
+
+		pos = (data->capture_head + cfg->capture_size - data->capture_count + idx) %
+		      cfg->capture_size;
+
+		*pval = cfg->capture[pos * cfg->num_channels + chn];
+	}
+
+	return frozen ? 0 : -EAGAIN;
+}
+
+static int adc_values_capture_set(const struct device *dev, value_id_t id, value_t val)
+{
+	struct adc_values_data *data = dev->data;
+
+	if (id == ADC_VALUES_CAPTURE_TRIGGER) {
+		if (val) {
+			atomic_set(&data->capture_request, 1);
+		}
+		return 0;
+	}
+
+	atomic_set(&data->capture_state, ADC_VALUES_CAPTURE_IDLE);
+
+	if (val) {
+		// restart capture
+		data->capture_count = 0;
+		atomic_clear(&data->capture_request);
+		atomic_set(&data->capture_state, ADC_VALUES_CAPTURE_ARMED);
+	}
+
+	return 0;
+}
+
 static int adc_values_value_get(const struct device *dev, value_id_t id, value_t *pval)
 {
 	const struct adc_values_config *cfg = dev->config;
 	struct adc_values_data *data = dev->data;
-	unsigned chn;
 	int rc = 0;
 
 	switch (id) {
@@ -143,18 +906,32 @@ static int adc_values_value_get(const struct device *dev, value_id_t id, value_t
 		*pval = cfg->num_channels;
 		break;
 
+	case ADC_VALUES_SAMPLINGS:
+		*pval = data->samplings;
+		break;
+
+	case ADC_VALUES_SCAN_TIME:
+		*pval = data->scan_time;
+		break;
+
+	case ADC_VALUES_STREAM_LOST:
+		*pval = data->stream_lost;
+		break;
+
 	default:
-		if (id & ADC_VALUES_CHANNEL_FLAG) {
-			chn = ADC_VALUES_CHANNEL_GET(id);
-			if (chn < cfg->num_channels) {
-				*pval = data->values[chn];
-				if (is_flag(data->fault, chn)) {
-					rc = -EFAULT;
-				} else if (!is_flag(data->ready, chn)) {
-					rc = -EAGAIN;
-				}
-				break;
-			}
+		if (adc_values_is_channel(dev, id)) {
+			rc = adc_values_channel_get(dev, ADC_VALUES_CHANNEL_GET(id), pval);
+			break;
+		}
+
+		if (cfg->ring != NULL && ADC_VALUES_IS_RING(id)) {
+			rc = adc_values_ring_get(dev, id, pval);
+			break;
+		}
+
+		if (cfg->capture != NULL && adc_values_is_capture(id)) {
+			rc = adc_values_capture_get(dev, id, pval);
+			break;
 		}
 
 		LOG_ERR("%s: attempt to get unknown value #%d", dev->name, id);
@@ -164,8 +941,28 @@ static int adc_values_value_get(const struct device *dev, value_id_t id, value_t
 	return rc;
 }
 
+static int adc_values_value_get_many(const struct device *dev, const value_id_t *ids,
+				     value_t *pvals, int *rcs, size_t num)
+{
+	size_t idx;
+	int rc = 0;
+
+	for (idx = 0; idx < num; idx++) {
+		rcs[idx] = adc_values_is_channel(dev, ids[idx]) ?
+			   adc_values_channel_get(dev, ADC_VALUES_CHANNEL_GET(ids[idx]),
+						  &pvals[idx]) :
+			   adc_values_value_get(dev, ids[idx], &pvals[idx]);
+		if (rcs[idx] != 0 && rc == 0) {
+			rc = rcs[idx];
+		}
+	}
+
+	return rc;
+}
+
 static int adc_values_value_set(const struct device *dev, value_id_t id, value_t val)
 {
+	const struct adc_values_config *cfg = dev->config;
 	struct adc_values_data *data = dev->data;
 	int rc = 0;
 
@@ -174,19 +971,39 @@ static int adc_values_value_set(const struct device *dev, value_id_t id, value_t
 		if (data->active && !val) {
 			reset_flags(data->ready);
 			reset_flags(data->fault);
+			reset_flags(data->dirty);
+
+			if (cfg->stream == NULL) {
+				// recover from stalled scan
+				adc_values_scan_reset(dev);
+			}
+		}
+
+		if (cfg->stream != NULL && val) {
+			// the streaming stops itself when inactive
+			// and is not restarted until stopped
+			data->active = true;
+			rc = adc_values_stream_start(dev);
 		}
 
-		data->active = val;
+		data->active = val && rc == 0;
 
 		break;
 
 	case ADC_VALUES_SYNC:
-		if (data->active) {
-			adc_values_task(dev, false);
+		// streaming is paced by hardware
+		if (data->active && cfg->stream == NULL) {
+			adc_values_task(dev);
 		}
 		break;
 
 	default:
+		if (cfg->capture != NULL &&
+		    (id == ADC_VALUES_CAPTURE_STATE || id == ADC_VALUES_CAPTURE_TRIGGER)) {
+			rc = adc_values_capture_set(dev, id, val);
+			break;
+		}
+
 		LOG_ERR("%s: attempt to set unknown value #%d", dev->name, id);
 		rc = -EINVAL;
 	}
@@ -197,25 +1014,210 @@ static int adc_values_value_set(const struct device *dev, value_id_t id, value_t
 static const struct value_driver_api adc_values_api = {
 	.get = adc_values_value_get,
 	.set = adc_values_value_set,
+	.get_many = adc_values_value_get_many,
 };
 
+/* get oversampling of channel */
+static inline uint8_t adc_values_oversampling(const struct device *dev, uint8_t chn)
+{
+	const struct adc_values_config *cfg = dev->config;
+
+	return cfg->oversampling[chn] != 0 ?
+	       cfg->oversampling[chn] :
+	       cfg->channel_specs[chn].oversampling;
+}
+
+/* check that channel can be converted in the same sequence with group */
+static bool adc_values_can_scan(const struct device *dev,
+				const struct adc_values_group *group,
+				uint8_t chn, uint8_t first)
+{
+	const struct adc_values_config *cfg = dev->config;
+	const struct adc_dt_spec *spec = &cfg->channel_specs[chn];
+
+	return spec->dev == group->adc &&
+	       !(group->sequence.channels & BIT(spec->channel_id)) &&
+	       spec->resolution == cfg->channel_specs[first].resolution &&
+	       cfg->oversampling[chn] == cfg->oversampling[first] &&
+	       adc_values_oversampling(dev, chn) == adc_values_oversampling(dev, first);
+}
+
+/* add channel to group keeping order of samples (by channel id) */
+static void adc_values_group_add(const struct device *dev, struct adc_values_group *group,
+				 uint8_t chn)
+{
+	const struct adc_values_config *cfg = dev->config;
+	const struct adc_dt_spec *specs = cfg->channel_specs;
+	unsigned idx = group->first + group->num_channels;
+
+	for (; idx > group->first &&
+	       specs[cfg->order[idx - 1]].channel_id > specs[chn].channel_id; idx--) {
+		cfg->order[idx] = cfg->order[idx - 1];
+	}
+
+	cfg->order[idx] = chn;
+	group->num_channels++;
+}
+
+/* split channels into groups of conversion sequences */
+static void adc_values_groups_init(const struct device *dev)
+{
+	const struct adc_values_config *cfg = dev->config;
+	struct adc_values_data *data = dev->data;
+	const struct adc_dt_spec *specs = cfg->channel_specs;
+	struct adc_values_group *group;
+	uint8_t grouped[ADC_VALUES_FLAG_BYTES] = { 0 };
+	unsigned first = 0;
+	unsigned offset = 0;
+	unsigned i, j;
+
+	data->num_groups = 0;
+	data->num_lanes = 0;
+
+	for (i = 0; i < cfg->num_channels; i++) {
+		if (is_flag(grouped, i) || specs[i].dev == NULL) {
+			// already grouped or unused channel number
+			continue;
+		}
+
+		group = &cfg->groups[data->num_groups++];
+		group->dev = dev;
+		group->adc = specs[i].dev;
+		group->options.callback = cfg->stream != NULL ?
+					  adc_values_stream_callback :
+					  adc_values_sequence_callback;
+		group->options.interval_us = cfg->stream_interval;
+		group->options.user_data = group;
+		group->sequence.options = &group->options;
+		group->first = first;
+		group->next = ADC_VALUES_NO_GROUP;
+		group->head = true;
+
+		// link to the previous group of the same ADC
+		for (j = data->num_groups - 1; j-- > 0;) {
+			if (cfg->groups[j].adc == group->adc) {
+				cfg->groups[j].next = data->num_groups - 1;
+				group->head = false;
+				break;
+			}
+		}
+
+		if (group->head) {
+			data->num_lanes++;
+		}
+
+		// the first channel of group is added anyway,
+		// it will be reported as faulted when unable to convert
+		adc_sequence_init_dt(&specs[i], &group->sequence);
+		adc_values_group_add(dev, group, i);
+		set_flag(grouped, i);
+
+		for (j = i + 1; cfg->scan && j < cfg->num_channels; j++) {
+			if (is_flag(grouped, j) || specs[j].dev == NULL ||
+			    !adc_values_can_scan(dev, group, j, i) ||
+			    adc_sequence_init_dt(&specs[j], &group->sequence)) {
+				continue;
+			}
+
+			adc_values_group_add(dev, group, j);
+			set_flag(grouped, j);
+		}
+
+		group->sequence.oversampling = adc_values_oversampling(dev, i);
+		group->sequence.buffer = &cfg->samples[offset];
+		group->sequence.buffer_size = group->num_channels * sizeof(cfg->samples[0]);
+
+		first += group->num_channels;
+		// reserve space for averaging
+		offset += group->num_channels << cfg->oversampling[i];
+	}
+}
+
 static int adc_values_init(const struct device *dev)
 {
 	const struct adc_values_config *cfg = dev->config;
+	struct adc_values_data *data = dev->data;
 	unsigned i;
 	int rc;
 
+	adc_values_conflicts_init(dev);
+
 	// Try to configure all known ADC channels
 	for (i = 0; i < cfg->num_channels; i++) {
+		if (cfg->channel_specs[i].dev == NULL) {
+			continue;
+		}
+
 		rc = adc_channel_setup_dt(&cfg->channel_specs[i]);
 		if (rc) {
 			LOG_ERR("%s: Error when setup ADC channel: #%u", dev->name, i);
 		}
 	}
 
+	adc_values_groups_init(dev);
+
+	if (cfg->capture_spec != NULL) {
+		value_sub_cb_init(&data->capture_cb, adc_values_capture_cb);
+
+		rc = value_sub_dt(cfg->capture_spec, &data->capture_cb, true);
+		if (rc) {
+			LOG_ERR("%s: Unable to subscribe to capture trigger", dev->name);
+			return rc;
+		}
+	}
+
+	if (cfg->stream != NULL) {
+		if (data->num_groups != 1) {
+			LOG_ERR("%s: Only channels of single ADC which can be scanned "
+				"together can be streamed", dev->name);
+			return -EINVAL;
+		}
+
+		if (data->active) {
+			return adc_values_stream_start(dev);
+		}
+	}
+
 	return 0;
 }
 
+/* convert raw sample using piecewise-linear interpolation of calibration points */
+static value_t adc_values_calibrate(const struct adc_values_calibration *cal, uint16_t raw)
+{
+	const int32_t *points = cal->points;
+	size_t lo = 0;
+	size_t hi = cal->num_points - 1;
+	size_t mid;
+
+	// clamp to the first and the last points
+	if (raw <= points[0]) {
+		return points[1];
+	}
+	if (raw >= points[2 * hi]) {
+		return points[2 * hi + 1];
+	}
+
+	if (cal->uniform) {
+		// index the segment directly
+		lo = (raw - points[0]) / (points[2] - points[0]);
+	} else {
+		// search the segment
+		while (hi - lo > 1) {
+			mid = (lo + hi) / 2;
+			if (raw < points[2 * mid]) {
+				hi = mid;
+			} else {
+				lo = mid;
+			}
+		}
+	}
+
+	points += 2 * lo;
+
+	return points[1] + (int64_t)(points[3] - points[1]) *
+	       (raw - points[0]) / (points[2] - points[0]);
+}
+
 #define NUM_CONS(numerator, denominator) \
 	(((double)(numerator)) / ((double)(denominator)))
 
@@ -248,20 +1250,193 @@ static int adc_values_init(const struct device *dev)
 #define _DT_GET_BIAS(node_id) \
 	DT_PROP_NUM_OR_SCALED(node_id, bias, 0, scale)
 
-#define _DT_CHANNEL_CONVERT(node_id)		     \
-case DT_REG_ADDR(node_id):			     \
-	return SAMPLE_CONVERT(raw,		     \
-			      _DT_GET_GAIN(node_id), \
-			      _DT_GET_BIAS(node_id));
+#define _DT_CAL(node_id) \
+	UTIL_CAT(adc_values_calibration_, DT_DEP_ORD(node_id))
+
+#define _DT_CAL_POINTS(node_id)	\
+	UTIL_CAT(adc_values_calibration_points_, DT_DEP_ORD(node_id))
+
+/* values are scaled, raw samples are not */
+#define _DT_CAL_POINT(node_id, prop, idx)    \
+	DT_PROP_BY_IDX(node_id, prop, idx) * \
+	((idx) % 2 ? DT_PROP_OR(node_id, scale, 1) : 1),
+
+#define _DT_CAL_CHECK_UNIFORM(node_id, prop, idx)		     \
+	BUILD_ASSERT((idx) % 2 ||				     \
+		     DT_PROP_BY_IDX(node_id, prop, idx) -	     \
+		     DT_PROP_BY_IDX(node_id, prop, 0) ==	     \
+		     (idx) / 2 * (DT_PROP_BY_IDX(node_id, prop, 2) - \
+				  DT_PROP_BY_IDX(node_id, prop, 0)), \
+		     "calibration points should be evenly spaced");
+
+/* raw samples of points are searched and used as divisors */
+#define _DT_CAL_CHECK_SORTED(node_id, prop, idx)			     \
+	BUILD_ASSERT((idx) % 2 || (idx) < 2 ||				     \
+		     DT_PROP_BY_IDX(node_id, prop, idx) >		     \
+		     DT_PROP_BY_IDX(node_id, prop, UTIL_DEC(UTIL_DEC(idx))), \
+		     "raw samples of calibration points should be increasing");
+
+#define _DT_CHANNEL_CALIBRATION(node_id)				\
+	BUILD_ASSERT(DT_PROP_LEN(node_id, calibration_points) >= 4 &&	\
+		     DT_PROP_LEN(node_id, calibration_points) % 2 == 0,	\
+		     "calibration should have at least two points");	\
+	DT_FOREACH_PROP_ELEM(node_id, calibration_points,		\
+			     _DT_CAL_CHECK_SORTED)			\
+	IF_ENABLED(DT_PROP(node_id, calibration_uniform),		\
+		   (DT_FOREACH_PROP_ELEM(node_id, calibration_points,	\
+					 _DT_CAL_CHECK_UNIFORM)))	\
+	static const int32_t _DT_CAL_POINTS(node_id)[] = {		\
+		DT_FOREACH_PROP_ELEM(node_id, calibration_points,	\
+				     _DT_CAL_POINT)			\
+	};								\
+	static const struct adc_values_calibration _DT_CAL(node_id) = {	\
+		.points = _DT_CAL_POINTS(node_id),			\
+		.num_points = ARRAY_SIZE(_DT_CAL_POINTS(node_id)) / 2,	\
+		.uniform = DT_PROP(node_id, calibration_uniform),	\
+	};
+
+#define _DT_CHANNEL_CALIBRATION_DEFINE(node_id)			  \
+	IF_ENABLED(DT_NODE_HAS_PROP(node_id, calibration_points), \
+		   (_DT_CHANNEL_CALIBRATION(node_id)))
+
+#define _DT_CHANNEL_CONVERT(node_id)					   \
+case DT_REG_ADDR(node_id):						   \
+	return COND_CODE_1(DT_NODE_HAS_PROP(node_id, calibration_points),  \
+			   (adc_values_calibrate(&_DT_CAL(node_id), raw)), \
+			   (SAMPLE_CONVERT(raw,				   \
+					   _DT_GET_GAIN(node_id),	   \
+					   _DT_GET_BIAS(node_id))));
 
 #define _DT_CHANNEL_INIT(node_id) \
 	0,
 
+#define _DT_CHANNEL_OVERSAMPLING(node_id) \
+	[DT_REG_ADDR(node_id)] = DT_PROP_OR(node_id, oversampling, 0),
+
+#define _DT_CHANNEL_LAZY(node_id) \
+	[DT_REG_ADDR(node_id)] = DT_PROP(node_id, lazy),
+
+#define _DT_CHANNEL_SAMPLES(node_id) \
+	(1 << DT_PROP_OR(node_id, oversampling, 0)) +
+
 #define _DT_CHANNEL_SPEC(node_id) \
 	[DT_REG_ADDR(node_id)] = ADC_DT_SPEC_GET_BY_IDX(node_id, 0),
 
+#define _DT_NUM_CHANNELS(inst) \
+	ARRAY_SIZE(adc_values_channels_##inst)
+
+#define _DT_HAS_STREAM(inst) \
+	DT_INST_NODE_HAS_PROP(inst, stream_interval_us)
+
+#define _DT_HAS_RING(inst) \
+	DT_INST_NODE_HAS_PROP(inst, ring_size)
+
+#define _DT_CHANNEL_ON_ADC(node_id, adc) \
+	+ DT_SAME_NODE(DT_IO_CHANNELS_CTLR(node_id), adc)
+
+#define _DT_POLLER_CHANNELS_ON_ADC(node_id, adc) \
+	DT_FOREACH_CHILD_VARGS(node_id, _DT_CHANNEL_ON_ADC, adc)
+
+/* number of channels of all pollers converted by ADC */
+#define _DT_ADC_CHANNELS(adc)					    \
+	(0 DT_FOREACH_STATUS_OKAY_VARGS(DT_DRV_COMPAT,		    \
+					_DT_POLLER_CHANNELS_ON_ADC, \
+					adc))
+
+#define _DT_CHANNEL_ANY(node_id, adc) \
+	+ 1
+
+/*
+ * The stream keeps ADC locked, so the other conversions of the same ADC
+ * would block value work queue until poller is deactivated.
+ */
+#define _DT_CHECK_STREAM_CHANNEL(node_id)					      \
+	BUILD_ASSERT(_DT_ADC_CHANNELS(DT_IO_CHANNELS_CTLR(node_id)) ==		      \
+		     (0 _DT_POLLER_CHANNELS_ON_ADC(DT_PARENT(node_id),		      \
+						   DT_IO_CHANNELS_CTLR(node_id))),    \
+		     "ADC values streaming ADC should not be used by other pollers"); \
+	BUILD_ASSERT((0 _DT_POLLER_CHANNELS_ON_ADC(DT_PARENT(node_id),		      \
+						   DT_IO_CHANNELS_CTLR(node_id))) ==  \
+		     (0 DT_FOREACH_CHILD_VARGS(DT_PARENT(node_id),		      \
+					       _DT_CHANNEL_ANY, 0)),		      \
+		     "ADC values streaming requires channels of single ADC");
+
+#define _DT_STREAM_DEFINE(inst)						\
+	BUILD_ASSERT(!_DT_HAS_RING(inst) || _DT_HAS_STREAM(inst),	\
+		     "ADC values ring requires streaming");		\
+	BUILD_ASSERT(!_DT_HAS_STREAM(inst) || DT_INST_PROP(inst, scan),	\
+		     "ADC values streaming requires scan");		\
+	IF_ENABLED(_DT_HAS_STREAM(inst),				\
+		   (DT_INST_FOREACH_CHILD(inst,				\
+					  _DT_CHECK_STREAM_CHANNEL)))	\
+	BUILD_ASSERT(DT_INST_PROP_OR(inst, ring_size, 0) <= 256,	\
+		     "ADC values ring is too big");			\
+	IF_ENABLED(_DT_HAS_STREAM(inst),				\
+		   (static uint16_t adc_values_stream_##inst[		\
+			    2 * DT_INST_PROP(inst, stream_block) *	\
+			    _DT_NUM_CHANNELS(inst)];))			\
+	IF_ENABLED(_DT_HAS_RING(inst),					\
+		   (static uint16_t adc_values_ring_##inst[		\
+			    DT_INST_PROP(inst, ring_size) *		\
+			    _DT_NUM_CHANNELS(inst)];))
+
+#define _DT_HAS_CAPTURE(inst) \
+	DT_INST_NODE_HAS_PROP(inst, capture_size)
+
+#define _DT_CAPTURE_SIZE(inst) \
+	DT_INST_PROP(inst, capture_size)
+
+#define _DT_CAPTURE_DEFINE(inst)						\
+	BUILD_ASSERT(DT_INST_PROP_OR(inst, capture_size, 0) <= 256,		\
+		     "ADC values capture is too big");				\
+	BUILD_ASSERT(!DT_INST_NODE_HAS_PROP(inst, capture_pre) ||		\
+		     DT_INST_PROP(inst, capture_pre) <				\
+		     DT_INST_PROP_OR(inst, capture_size, 0),			\
+		     "ADC values capture pre-trigger part is too big");		\
+	BUILD_ASSERT(DT_INST_PROP_OR(inst, capture_channel, 0) <		\
+		     _DT_NUM_CHANNELS(inst),					\
+		     "ADC values capture channel is unknown");			\
+	BUILD_ASSERT(_DT_HAS_CAPTURE(inst) ||					\
+		     !(DT_INST_NODE_HAS_PROP(inst, capture_channel) ||		\
+		       DT_INST_NODE_HAS_PROP(inst, capture_trigger)),		\
+		     "ADC values capture trigger requires capture-size");	\
+	IF_ENABLED(_DT_HAS_CAPTURE(inst),					\
+		   (static uint16_t adc_values_capture_##inst[			\
+			    _DT_CAPTURE_SIZE(inst) * _DT_NUM_CHANNELS(inst)];))	\
+	IF_ENABLED(DT_INST_NODE_HAS_PROP(inst, capture_trigger),		\
+		   (static const struct value_dt_spec				\
+			    adc_values_capture_spec_##inst =			\
+			    VALUE_DT_SPEC_INST_GET_BY_IDX(inst,			\
+							  capture_trigger, 0);))
+
+#define _DT_CAPTURE_CONFIG(inst)						\
+	IF_ENABLED(_DT_HAS_CAPTURE(inst),					\
+		   (.capture = adc_values_capture_##inst,			\
+		    .capture_size = _DT_CAPTURE_SIZE(inst),			\
+		    .capture_pre = DT_INST_PROP_OR(inst, capture_pre,		\
+						   _DT_CAPTURE_SIZE(inst) / 2),	\
+		    .capture_threshold =					\
+			    DT_INST_PROP_OR(inst, capture_threshold, 0),	\
+		    .capture_edge =						\
+			    DT_INST_ENUM_IDX(inst, capture_edge) + 1,))		\
+	.capture_channel = DT_INST_PROP_OR(inst, capture_channel,		\
+					   ADC_VALUES_NO_CHANNEL),		\
+	IF_ENABLED(DT_INST_NODE_HAS_PROP(inst, capture_trigger),		\
+		   (.capture_spec = &adc_values_capture_spec_##inst,))
+
+#define _DT_STREAM_CONFIG(inst)						       \
+	IF_ENABLED(_DT_HAS_STREAM(inst),				       \
+		   (.stream = adc_values_stream_##inst,			       \
+		    .stream_interval = DT_INST_PROP(inst, stream_interval_us), \
+		    .stream_block = DT_INST_PROP(inst, stream_block),))	       \
+	IF_ENABLED(_DT_HAS_RING(inst),					       \
+		   (.ring = adc_values_ring_##inst,			       \
+		    .ring_size = DT_INST_PROP(inst, ring_size),))
+
 #define ADC_VALUES_DEVICE(inst)						     \
 									     \
+	DT_INST_FOREACH_CHILD(inst, _DT_CHANNEL_CALIBRATION_DEFINE)	     \
+									     \
 	value_t adc_values_convert_##inst(value_id_t id, uint16_t raw)	     \
 	{								     \
 		switch (id) {						     \
@@ -274,24 +1449,36 @@ case DT_REG_ADDR(node_id):			     \
 		DT_INST_FOREACH_CHILD(inst, _DT_CHANNEL_SPEC)		     \
 	};								     \
 									     \
-	static const struct adc_sequence_options			     \
-		adc_values_sequence_options_##inst = {			     \
-		.interval_us = 0,       /* TODO: make it configurable */     \
-		.callback = adc_values_sequence_callback,		     \
-		.user_data = (void *)DEVICE_DT_INST_GET(inst),		     \
+	BUILD_ASSERT(_DT_NUM_CHANNELS(inst) <=				     \
+		     CONFIG_ADC_VALUES_MAX_CHANNELS,			     \
+		     "ADC values has too many channels");		     \
+									     \
+	static struct adc_values_group					     \
+		adc_values_groups_##inst[_DT_NUM_CHANNELS(inst)];	     \
+									     \
+	static uint8_t adc_values_order_##inst[_DT_NUM_CHANNELS(inst)];	     \
+									     \
+	static const uint8_t adc_values_oversampling_##inst[] = {	     \
+		DT_INST_FOREACH_CHILD(inst, _DT_CHANNEL_OVERSAMPLING)	     \
+	};								     \
+									     \
+	static uint16_t adc_values_samples_##inst[			     \
+		DT_INST_FOREACH_CHILD(inst, _DT_CHANNEL_SAMPLES) 0];	     \
+									     \
+	static const bool adc_values_lazy_##inst[] = {			     \
+		DT_INST_FOREACH_CHILD(inst, _DT_CHANNEL_LAZY)		     \
 	};								     \
 									     \
-	uint16_t adc_values_samples_buffer_##inst[1];			     \
+	static uint16_t adc_values_raws_##inst[_DT_NUM_CHANNELS(inst)];	     \
+									     \
+	_DT_STREAM_DEFINE(inst)						     \
+									     \
+	_DT_CAPTURE_DEFINE(inst)					     \
 									     \
 	static struct adc_values_data adc_values_data_##inst = {	     \
 		.active = DT_INST_PROP(inst, initial_active),		     \
+		.dev = DEVICE_DT_INST_GET(inst),			     \
 		.work = Z_WORK_INITIALIZER(adc_values_work_handler),	     \
-		.sequence = {						     \
-			.options = &adc_values_sequence_options_##inst,	     \
-			.buffer = adc_values_samples_buffer_##inst,	     \
-			.buffer_size =					     \
-				sizeof(adc_values_samples_buffer_##inst),    \
-		},							     \
 		.values = { DT_INST_FOREACH_CHILD(inst, _DT_CHANNEL_INIT) }, \
 	};								     \
 									     \
@@ -299,6 +1486,16 @@ case DT_REG_ADDR(node_id):			     \
 		.channel_specs = adc_values_channels_##inst,		     \
 		.num_channels = ARRAY_SIZE(adc_values_channels_##inst),	     \
 		.convert = adc_values_convert_##inst,			     \
+		.groups = adc_values_groups_##inst,			     \
+		.order = adc_values_order_##inst,			     \
+		.oversampling = adc_values_oversampling_##inst,		     \
+		.lazy = adc_values_lazy_##inst,				     \
+		.raws = adc_values_raws_##inst,				     \
+		.samples = adc_values_samples_##inst,			     \
+		.scan = DT_INST_PROP(inst, scan),			     \
+		.isr_convert = DT_INST_PROP(inst, isr_convert),		     \
+		_DT_STREAM_CONFIG(inst)					     \
+		_DT_CAPTURE_CONFIG(inst)				     \
 	};								     \
 									     \
 	DEVICE_DT_INST_DEFINE(inst, adc_values_init, NULL,		     \
@@ -25,6 +25,7 @@ static int cmd_list(const struct shell *shell, size_t argc, char **argv)
 	size_t i;
 	value_t state;
 	value_t num_channels;
+	value_t scan_time;
 
 	ARG_UNUSED(argc);
 	ARG_UNUSED(argv);
@@ -35,9 +36,10 @@ static int cmd_list(const struct shell *shell, size_t argc, char **argv)
 
 		value_get(dev, ADC_VALUES_STATE, &state);
 		value_get(dev, ADC_VALUES_NUM_CHANNELS, &num_channels);
+		value_get(dev, ADC_VALUES_SCAN_TIME, &scan_time);
 
-		shell_print(shell, "[%i] %s (chs: %d): %s",
-			    i, dev->name, num_channels,
+		shell_print(shell, "[%i] %s (chs: %d, scan: %d nS): %s",
+			    i, dev->name, num_channels, scan_time,
 			    state ? "on" : "off");
 	}
 	return 0;
@@ -137,6 +139,83 @@ static int cmd_read(const struct shell *shell, size_t argc, char **argv)
 	return rc;
 }
 
+static int cmd_capture(const struct shell *shell, size_t argc, char **argv)
+{
+	const struct device *dev;
+	int rc;
+
+	rc = parse_common_args(shell, argv, &dev, NULL);
+	if (rc < 0) {
+		return rc;
+	}
+
+	rc = argv[0][0] == 't' ?
+	     value_set(dev, ADC_VALUES_CAPTURE_TRIGGER, 1) :
+	     value_set(dev, ADC_VALUES_CAPTURE_STATE, 1);
+	if (rc < 0) {
+		shell_print(shell, "%s: Error when %s capture", dev->name,
+			    argv[0][0] == 't' ? "triggering" : "arming");
+	}
+
+	return rc;
+}
+
+static int cmd_dump(const struct shell *shell, size_t argc, char **argv)
+{
+	const struct device *dev;
+	uint8_t line[SHELL_HEXDUMP_BYTES_IN_LINE];
+	size_t offset = 0;
+	size_t pos = 0;
+	value_t num_channels;
+	value_t length;
+	value_t trigger;
+	value_t raw;
+	value_t idx;
+	value_t chn;
+	int rc;
+
+	rc = parse_common_args(shell, argv, &dev, NULL);
+	if (rc < 0) {
+		return rc;
+	}
+
+	rc = value_get(dev, ADC_VALUES_CAPTURE_LENGTH, &length);
+	if (rc < 0) {
+		shell_error(shell, "%s: Capture is not done", dev->name);
+		return rc;
+	}
+
+	value_get(dev, ADC_VALUES_CAPTURE_TRIGGER, &trigger);
+	value_get(dev, ADC_VALUES_NUM_CHANNELS, &num_channels);
+
+	shell_print(shell, "%s: scans: %d, chs: %d, trigger: %d",
+		    dev->name, length, num_channels, trigger);
+
+	// raw samples of scans as little-endian 16-bit words
+	for (idx = 0; idx < length; idx++) {
+		for (chn = 0; chn < num_channels; chn++) {
+			if (value_get(dev, ADC_VALUES_CAPTURE(chn, idx), &raw) < 0) {
+				raw = 0;
+			}
+
+			line[pos++] = raw & 0xff;
+			line[pos++] = raw >> 8;
+
+			if (pos == sizeof(line)) {
+				shell_hexdump_line(shell, offset, line, pos);
+				offset += pos;
+				pos = 0;
+			}
+		}
+	}
+
+	if (pos > 0) {
+		shell_hexdump_line(shell, offset, line, pos);
+	}
+
+	return 0;
+}
+
 static void dev_name_get(size_t idx, struct shell_static_entry *entry)
 {
 	entry->syntax = idx < num_devices ? device_ptr[idx]->name : NULL;
@@ -153,6 +232,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 	SHELL_CMD_ARG(on, &dev_name, "<device> Enable polling", cmd_state, 2, 0),
 	SHELL_CMD_ARG(off, &dev_name, "<device> Disable polling", cmd_state, 2, 0),
 	SHELL_CMD_ARG(get, &dev_name, "<device> <channel> Get channel value", cmd_read, 3, 0),
+	SHELL_CMD_ARG(capture, &dev_name, "<device> Arm capture", cmd_capture, 2, 0),
+	SHELL_CMD_ARG(trigger, &dev_name, "<device> Trigger capture", cmd_capture, 2, 0),
+	SHELL_CMD_ARG(dump, &dev_name, "<device> Dump captured raw samples", cmd_dump, 2, 0),
 	SHELL_SUBCMD_SET_END);
 
 SHELL_CMD_REGISTER(adcvals, &sub_adcvals, "Value sync commands", NULL);
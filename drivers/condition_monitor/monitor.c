@@ -29,11 +29,9 @@ static void monitor_task(const struct device *dev)
 	const struct monitor_config *config = dev->config;
 	struct monitor_data *data = dev->data;
 
-	const struct value_dt_spec *value_spec = config->values;
-	const struct value_dt_spec *end_value_spec = config->values + config->num_values;
-
-	value_t value;
-	int rc;
+	value_t values[config->num_values];
+	int rcs[config->num_values];
+	unsigned idx;
 	bool under;
 	bool over;
 
@@ -41,18 +39,18 @@ static void monitor_task(const struct device *dev)
 		return;
 	}
 
-	for (; value_spec < end_value_spec; value_spec++) {
-		rc = value_get_dt(value_spec, &value);
+	value_get_many_dt(config->values, values, rcs, config->num_values);
 
-		if (rc != 0) {
-			if (rc != -EAGAIN) {
+	for (idx = 0; idx < config->num_values; idx++) {
+		if (rcs[idx] != 0) {
+			if (rcs[idx] != -EAGAIN) {
 				LOG_ERR("%s: Error when getting value", dev->name);
 			}
 			continue;
 		}
 
-		over = value > config->maximum;
-		under = value < config->minimum;
+		over = values[idx] > config->maximum;
+		under = values[idx] < config->minimum;
 
 		if (over || under) {
 			LOG_WRN("%s: %svalue detected", dev->name,
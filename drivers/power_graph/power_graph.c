@@ -2,6 +2,7 @@
 #include <zephyr/kernel.h>
 #include <zephyr/device.h>
 #include <zephyr/drivers/value.h>
+#include <zephyr/drivers/value_workq.h>
 #include <zephyr/dt-bindings/regulator_extended.h>
 #include <zephyr/dt-bindings/power_graph.h>
 
@@ -474,7 +475,7 @@ static void power_graph_cb(struct value_sub_cb *cb,
 		data->new_state = cfg->safe_state;
 	}
 
-	k_work_submit(&data->work);
+	value_work_submit(&data->work);
 }
 
 static int power_graph_get(const struct device *dev,
@@ -567,7 +568,7 @@ static int power_graph_set(const struct device *dev,
 
 		data->new_state = value;
 
-		k_work_submit(&data->work);
+		value_work_submit(&data->work);
 
 		break;
 	default:
@@ -1,6 +1,7 @@
 #include <zephyr/kernel.h>
 #include <zephyr/device.h>
 #include <zephyr/drivers/value.h>
+#include <zephyr/drivers/value_workq.h>
 #include <zephyr/dt-bindings/gpio_extra.h>
 #include <zephyr/dt-bindings/regulator_extended.h>
 #include <zephyr/drivers/gpio.h>
@@ -275,7 +276,7 @@ static void finalize_transition(struct driver_data *data, uint32_t delay_us)
 			int rc;
 
 			LOG_DBG("work queue wait");
-			rc = k_work_schedule(&data->work, K_USEC(delay_us));
+			rc = value_work_schedule(&data->work, K_USEC(delay_us));
 
 			if (rc >= 0) {
 				LOG_DBG("schedule ok");
@@ -408,7 +409,7 @@ static int regulator_extended_set(const struct device *dev, value_id_t id, value
 			/* Perform the disable and finalization in a work item. */
 			LOG_DBG("%s: %s deferred", dev->name, value ? "enable" : "disable");
 			data->state = driver_state_defferred;
-			k_work_schedule(&data->work, K_NO_WAIT);
+			value_work_schedule(&data->work, K_NO_WAIT);
 			return 0;
 		} else if (rc < 0) {
 			data->state = driver_state_failed;
@@ -17,18 +17,21 @@ LOG_MODULE_REGISTER(calc, CONFIG_VALUE_CALC_LOG_LEVEL);
 
 #define MAX_FLAG_BYTES ((CONFIG_VALUE_CALC_MAX_RESULTS + 7) / 8)
 
-#define CALC_DATA_STRUCT(type_name, num_results_) \
-	struct type_name {			  \
-		bool active;			  \
-		uint8_t ready[MAX_FLAG_BYTES];	  \
-		value_t results[num_results_];	  \
+#define CALC_DATA_STRUCT(type_name, num_results_)  \
+	struct type_name {			   \
+		bool active;			   \
+		/* recalculate all operations */   \
+		bool recalc;			   \
+		/* number of skipped operations */ \
+		uint32_t skipped;		   \
+		uint8_t ready[MAX_FLAG_BYTES];	   \
+		value_t results[num_results_];	   \
 	}
 
 CALC_DATA_STRUCT(calc_data, 0);
 
 typedef void calc_func(const struct value_dt_spec *values,
-		       uint8_t *ready,
-		       value_t *results);
+		       struct calc_data *data);
 
 #define CALC_CONFIG_STRUCT(type_name, num_values_) \
 	struct type_name {			   \
@@ -61,12 +64,116 @@ static inline void reset_flags(uint8_t *data)
 	memset(data, 0, MAX_FLAG_BYTES);
 }
 
+/* get mask of values which changed since last time */
+static uint64_t calc_changes(const value_t *vals, const int *rcs,
+			     value_t *last_vals, int *last_rcs, size_t num)
+{
+	uint64_t changed = 0;
+	size_t idx;
+
+	for (idx = 0; idx < num; idx++) {
+		if (vals[idx] != last_vals[idx] || rcs[idx] != last_rcs[idx]) {
+			changed |= BIT64(idx);
+			last_vals[idx] = vals[idx];
+			last_rcs[idx] = rcs[idx];
+		}
+	}
+
+	return changed;
+}
+
+/* rescale using 64-bit intermediate */
+static inline int64_t calc_rescale(int64_t a, int64_t sa, int64_t sr)
+{
+	return a * sr / sa;
+}
+
+static inline int64_t calc_abs(int64_t a, int64_t sa, int64_t sr)
+{
+	a = calc_rescale(a, sa, sr);
+
+	return a < 0 ? -a : a;
+}
+
+static inline int64_t calc_clamp(int64_t a, int64_t lo, int64_t hi,
+				 int64_t sa, int64_t slo, int64_t shi, int64_t sr)
+{
+	a = calc_rescale(a, sa, sr);
+	lo = calc_rescale(lo, slo, sr);
+	hi = calc_rescale(hi, shi, sr);
+
+	return a < lo ? lo : a > hi ? hi : a;
+}
+
+/* integer square root (bit by bit) */
+static inline uint64_t calc_isqrt(uint64_t a)
+{
+	uint64_t bit = (uint64_t)1 << 62;
+	uint64_t res = 0;
+
+	while (bit > a) {
+		bit >>= 2;
+	}
+
+	while (bit != 0) {
+		if (a >= res + bit) {
+			a -= res + bit;
+			res = (res >> 1) + bit;
+		} else {
+			res >>= 1;
+		}
+		bit >>= 2;
+	}
+
+	return res;
+}
+
+/* sqrt(a) = sqrt(a * sr) / sr */
+static inline int64_t calc_sqrt(int64_t a, int64_t sa, int64_t sr)
+{
+	return calc_isqrt(calc_rescale(a, sa, sr) * sr);
+}
+
+/* sqrt(a * a + b * b) */
+static inline int64_t calc_hypot(int64_t a, int64_t b, int64_t sa, int64_t sb, int64_t sr)
+{
+	a = calc_rescale(a, sa, sr);
+	b = calc_rescale(b, sb, sr);
+
+	return calc_isqrt((uint64_t)(a * a) + (uint64_t)(b * b));
+}
+
+/* a + (b - a) * t */
+static inline int64_t calc_lerp(int64_t a, int64_t b, int64_t t,
+				int64_t sa, int64_t sb, int64_t st, int64_t sr)
+{
+	a = calc_rescale(a, sa, sr);
+	b = calc_rescale(b, sb, sr);
+
+	return a + (b - a) * t / st;
+}
+
+/* c0 + x * (c1 + x * (c2 + ...)) using Horner's method */
+static ALWAYS_INLINE int64_t calc_poly(int64_t x, int64_t sx, const value_t *coefs,
+				       size_t num, int64_t sc, int64_t sr)
+{
+	int64_t acc = 0;
+	size_t idx;
+
+	/* the number of coefficients is constant, so the loop is unrolled */
+	for (idx = num; idx > 0; idx--) {
+		acc = acc * x / sx + coefs[idx - 1];
+	}
+
+	return calc_rescale(acc, sc, sr);
+}
+
 static void calc_task(const struct device *dev)
 {
 	const struct calc_config *cfg = dev->config;
 	struct calc_data *data = dev->data;
 
-	cfg->calculate(cfg->values, data->ready, data->results);
+	cfg->calculate(cfg->values, data);
 }
 
 static int calc_value_get(const struct device *dev, value_id_t id, value_t *pval)
@@ -84,6 +191,10 @@ static int calc_value_get(const struct device *dev, value_id_t id, value_t *pval
 		*pval = cfg->num_results;
 		break;
 
+	case CALC_SKIPPED:
+		*pval = data->skipped;
+		break;
+
 	default:
 		if (id < cfg->num_results) {
 			*pval = data->results[id];
@@ -98,6 +209,29 @@ static int calc_value_get(const struct device *dev, value_id_t id, value_t *pval
 	return rc;
 }
 
+static int calc_value_get_many(const struct device *dev, const value_id_t *ids,
+			       value_t *pvals, int *rcs, size_t num)
+{
+	const struct calc_config *cfg = dev->config;
+	struct calc_data *data = dev->data;
+	size_t idx;
+	int rc = 0;
+
+	for (idx = 0; idx < num; idx++) {
+		if (ids[idx] < cfg->num_results) {
+			pvals[idx] = data->results[ids[idx]];
+			rcs[idx] = 0;
+		} else {
+			rcs[idx] = calc_value_get(dev, ids[idx], &pvals[idx]);
+		}
+		if (rcs[idx] != 0 && rc == 0) {
+			rc = rcs[idx];
+		}
+	}
+
+	return rc;
+}
+
 static int calc_value_set(const struct device *dev, value_id_t id, value_t val)
 {
 	// const struct calc_config *cfg = dev->config;
@@ -111,10 +245,16 @@ static int calc_value_set(const struct device *dev, value_id_t id, value_t val)
 		}
 
 		data->active = val;
+		data->recalc = true;
 		reset_flags(data->ready);
 
 		break;
 
+	case CALC_SKIPPED:
+		/* reset counter */
+		data->skipped = val;
+		break;
+
 	case CALC_SYNC:
 		if (data->active) {
 			calc_task(dev);
@@ -133,6 +273,7 @@ static int calc_value_set(const struct device *dev, value_id_t id, value_t val)
 static const struct value_driver_api calc_api = {
 	.get = calc_value_get,
 	.set = calc_value_set,
+	.get_many = calc_value_get_many,
 };
 
 static int calc_init(const struct device *dev)
@@ -140,15 +281,37 @@ static int calc_init(const struct device *dev)
 	return 0;
 }
 
-#define _CALC_OP_scl(a, b, sa, sb, sr) FIXP_RESCALE(a, sa, sr)
-#define _CALC_OP_neg(a, b, sa, sb, sr) FIXP_NEG(a, sa, sr)
-#define _CALC_OP_inv(a, b, sa, sb, sr) FIXP_INV(a, sa, sr)
-#define _CALC_OP_add(a, b, sa, sb, sr) FIXP_ADD(a, b, sa, sb, sr)
-#define _CALC_OP_sub(a, b, sa, sb, sr) FIXP_SUB(a, b, sa, sb, sr)
-#define _CALC_OP_mul(a, b, sa, sb, sr) FIXP_MUL(a, b, sa, sb, sr)
-#define _CALC_OP_div(a, b, sa, sb, sr) FIXP_DIV(a, b, sa, sb, sr)
-#define _CALC_OP_min(a, b, sa, sb, sr) MIN(FIXP_RESCALE(a, sa, sr), FIXP_RESCALE(b, sb, sr))
-#define _CALC_OP_max(a, b, sa, sb, sr) MAX(FIXP_RESCALE(a, sa, sr), FIXP_RESCALE(b, sb, sr))
+/* compare a and b exactly without rescaling (result is 1 or 0) */
+#define _CALC_CMP(a, b, sa, sb, sr, cmp) \
+	((int64_t)(a) * (sb) cmp (int64_t)(b) * (sa) ? (sr) : 0)
+
+#define _CALC_OP_scl(n, a, b, c, sa, sb, sc, sr) FIXP_RESCALE(a, sa, sr)
+#define _CALC_OP_neg(n, a, b, c, sa, sb, sc, sr) FIXP_NEG(a, sa, sr)
+#define _CALC_OP_inv(n, a, b, c, sa, sb, sc, sr) FIXP_INV(a, sa, sr)
+#define _CALC_OP_add(n, a, b, c, sa, sb, sc, sr) FIXP_ADD(a, b, sa, sb, sr)
+#define _CALC_OP_sub(n, a, b, c, sa, sb, sc, sr) FIXP_SUB(a, b, sa, sb, sr)
+#define _CALC_OP_mul(n, a, b, c, sa, sb, sc, sr) FIXP_MUL(a, b, sa, sb, sr)
+#define _CALC_OP_div(n, a, b, c, sa, sb, sc, sr) FIXP_DIV(a, b, sa, sb, sr)
+#define _CALC_OP_min(n, a, b, c, sa, sb, sc, sr) \
+	MIN(FIXP_RESCALE(a, sa, sr), FIXP_RESCALE(b, sb, sr))
+#define _CALC_OP_max(n, a, b, c, sa, sb, sc, sr) \
+	MAX(FIXP_RESCALE(a, sa, sr), FIXP_RESCALE(b, sb, sr))
+#define _CALC_OP_abs(n, a, b, c, sa, sb, sc, sr) calc_abs(a, sa, sr)
+#define _CALC_OP_clamp(n, a, b, c, sa, sb, sc, sr) calc_clamp(a, b, c, sa, sb, sc, sr)
+#define _CALC_OP_sqrt(n, a, b, c, sa, sb, sc, sr) calc_sqrt(a, sa, sr)
+#define _CALC_OP_hypot(n, a, b, c, sa, sb, sc, sr) calc_hypot(a, b, sa, sb, sr)
+#define _CALC_OP_lt(n, a, b, c, sa, sb, sc, sr) _CALC_CMP(a, b, sa, sb, sr, <)
+#define _CALC_OP_le(n, a, b, c, sa, sb, sc, sr) _CALC_CMP(a, b, sa, sb, sr, <=)
+#define _CALC_OP_gt(n, a, b, c, sa, sb, sc, sr) _CALC_CMP(a, b, sa, sb, sr, >)
+#define _CALC_OP_ge(n, a, b, c, sa, sb, sc, sr) _CALC_CMP(a, b, sa, sb, sr, >=)
+#define _CALC_OP_eq(n, a, b, c, sa, sb, sc, sr) _CALC_CMP(a, b, sa, sb, sr, ==)
+#define _CALC_OP_ne(n, a, b, c, sa, sb, sc, sr) _CALC_CMP(a, b, sa, sb, sr, !=)
+#define _CALC_OP_select(n, a, b, c, sa, sb, sc, sr) \
+	((a) != 0 ? calc_rescale(b, sb, sr) : calc_rescale(c, sc, sr))
+#define _CALC_OP_lerp(n, a, b, c, sa, sb, sc, sr) calc_lerp(a, b, c, sa, sb, sc, sr)
+#define _CALC_OP_poly(n, a, b, c, sa, sb, sc, sr)		\
+	calc_poly(a, sa, _CALC_COEFS(n), DT_PROP_LEN(n, coefs),	\
+		  DT_PROP(n, coefs_scale), sr)
 
 #define _CALC_OP_IS_SAFE_scl(a, b) true
 #define _CALC_OP_IS_SAFE_neg(a, b) true
@@ -159,6 +322,22 @@ static int calc_init(const struct device *dev)
 #define _CALC_OP_IS_SAFE_div(a, b) ((b) != 0)
 #define _CALC_OP_IS_SAFE_min(a, b) true
 #define _CALC_OP_IS_SAFE_max(a, b) true
+#define _CALC_OP_IS_SAFE_abs(a, b) true
+#define _CALC_OP_IS_SAFE_clamp(a, b) true
+#define _CALC_OP_IS_SAFE_sqrt(a, b) ((a) >= 0)
+#define _CALC_OP_IS_SAFE_hypot(a, b) true
+#define _CALC_OP_IS_SAFE_lt(a, b) true
+#define _CALC_OP_IS_SAFE_le(a, b) true
+#define _CALC_OP_IS_SAFE_gt(a, b) true
+#define _CALC_OP_IS_SAFE_ge(a, b) true
+#define _CALC_OP_IS_SAFE_eq(a, b) true
+#define _CALC_OP_IS_SAFE_ne(a, b) true
+#define _CALC_OP_IS_SAFE_select(a, b) true
+#define _CALC_OP_IS_SAFE_lerp(a, b) true
+#define _CALC_OP_IS_SAFE_poly(a, b) true
+
+#define _CALC_COEFS(node_id) \
+	UTIL_CAT(_coefs_, DT_NODE_CHILD_IDX(node_id))
 
 #define _CALC_VAR(node_id, prop) \
 	UTIL_CAT(_var_, DT_STRING_TOKEN(node_id, prop))
@@ -190,8 +369,9 @@ static int calc_init(const struct device *dev)
 
 #define _CALC_RES_DEF(node_id)						  \
 	IF_ENABLED(DT_NODE_HAS_PROP(node_id, res_name),			  \
-		   (value_t _CALC_VAR(node_id, res_name);		  \
-		    bool UTIL_CAT(_CALC_VAR(node_id, res_name), _ready);  \
+		   (static value_t _CALC_VAR(node_id, res_name);	  \
+		    static bool UTIL_CAT(_CALC_VAR(node_id, res_name),	  \
+					 _ready);			  \
 		    const value_t					  \
 		    UTIL_CAT(_scl_, DT_STRING_TOKEN(node_id, res_name)) = \
 			    DT_PROP(node_id, res_scale); ))
@@ -219,13 +399,16 @@ static int calc_init(const struct device *dev)
 	const value_t						       \
 	UTIL_CAT(_scl_, DT_STRING_TOKEN_BY_IDX(node_id,		       \
 					       value_names, idx)) =    \
-		DT_PROP_BY_IDX(node_id, value_scales, idx);
+		DT_PROP_BY_IDX(node_id, value_scales, idx);	       \
+	const uint64_t						       \
+	UTIL_CAT(_dep_, DT_STRING_TOKEN_BY_IDX(node_id,		       \
+					       value_names, idx)) =    \
+		BIT64(idx);
 
 #define _CALC_VALUE_GET(node_id, prop, idx)			   \
+	_CALC_VAR_N(node_id, value_names, idx) = _vals[idx];	   \
 	UTIL_CAT(_CALC_VAR_N(node_id, value_names, idx), _ready) = \
-	0 ==							   \
-	value_get_dt(&values[idx],				   \
-		     &_CALC_VAR_N(node_id, value_names, idx));
+		_rcs[idx] == 0;
 
 #define _CALC_OP_IS_SAFE(node_id) \
 	UTIL_CAT(_CALC_OP_IS_SAFE_, DT_STRING_TOKEN(node_id, op))
@@ -233,20 +416,56 @@ static int calc_init(const struct device *dev)
 #define _CALC_OP(node_id) \
 	UTIL_CAT(_CALC_OP_, DT_STRING_TOKEN(node_id, op))
 
-#define _CALC_OP_IMPL(node_id)					\
-	if (_CALC_ARG_IS_READY(node_id, 1) &&			\
-	    _CALC_ARG_IS_READY(node_id, 2) &&			\
-	    _CALC_OP_IS_SAFE(node_id)(_CALC_ARG(node_id, 1),	\
-				      _CALC_ARG(node_id, 2))) {	\
-		_CALC_RES(node_id)				\
-		_CALC_OP(node_id)(_CALC_ARG(node_id, 1),	\
-				  _CALC_ARG(node_id, 2),	\
-				  _CALC_ARG_SCALE(node_id, 1),	\
-				  _CALC_ARG_SCALE(node_id, 2),	\
-				  _CALC_RES_SCALE(node_id));	\
-		_CALC_RES_SET_READY(node_id, 1)			\
-	} else {						\
-		_CALC_RES_SET_READY(node_id, 0)			\
+#define _CALC_DEPS(node_id) \
+	UTIL_CAT(_deps_, DT_NODE_CHILD_IDX(node_id))
+
+/* mask of values which argument depends on */
+#define _CALC_ARG_DEPS(node_id, n)					 \
+	COND_CODE_1(DT_NODE_HAS_PROP(node_id, _CALC_ARG_VAR(n, name)),	 \
+		    (UTIL_CAT(_dep_,					 \
+			      DT_STRING_TOKEN(node_id,			 \
+					      _CALC_ARG_VAR(n, name)))), \
+		    (0))
+
+/* masks of values which operation depends on are known at build time */
+#define _CALC_DEPS_DEF(node_id)						  \
+	const uint64_t _CALC_DEPS(node_id) =				  \
+		_CALC_ARG_DEPS(node_id, 1) | _CALC_ARG_DEPS(node_id, 2) | \
+		_CALC_ARG_DEPS(node_id, 3);				  \
+	IF_ENABLED(DT_NODE_HAS_PROP(node_id, res_name),			  \
+		   (const uint64_t					  \
+		    UTIL_CAT(_dep_, DT_STRING_TOKEN(node_id, res_name)) = \
+			    _CALC_DEPS(node_id);))
+
+#define _CALC_OP_DEF(node_id)					    \
+	BUILD_ASSERT(!DT_ENUM_HAS_VALUE(node_id, op, poly) ||	    \
+		     DT_NODE_HAS_PROP(node_id, coefs),		    \
+		     "Polynomial operation requires coefficients"); \
+	IF_ENABLED(DT_NODE_HAS_PROP(node_id, coefs),		    \
+		   (static const value_t _CALC_COEFS(node_id)[] =   \
+			    DT_PROP(node_id, coefs);))
+
+#define _CALC_OP_IMPL(node_id)					    \
+	if (!(_changed & _CALC_DEPS(node_id))) {		    \
+		/* arguments is not changed */			    \
+		data->skipped++;				    \
+	} else if (_CALC_ARG_IS_READY(node_id, 1) &&		    \
+		   _CALC_ARG_IS_READY(node_id, 2) &&		    \
+		   _CALC_ARG_IS_READY(node_id, 3) &&		    \
+		   _CALC_OP_IS_SAFE(node_id)(_CALC_ARG(node_id, 1), \
+				     _CALC_ARG(node_id, 2))) {	    \
+		_CALC_RES(node_id)				    \
+		_CALC_OP(node_id)(node_id,			    \
+				  _CALC_ARG(node_id, 1),	    \
+				  _CALC_ARG(node_id, 2),	    \
+				  _CALC_ARG(node_id, 3),	    \
+				  _CALC_ARG_SCALE(node_id, 1),	    \
+				  _CALC_ARG_SCALE(node_id, 2),	    \
+				  _CALC_ARG_SCALE(node_id, 3),	    \
+				  _CALC_RES_SCALE(node_id));	    \
+		_CALC_RES_SET_READY(node_id, 1)			    \
+	} else {						    \
+		_CALC_RES_SET_READY(node_id, 0)			    \
 	}
 
 #define _CALC_VALUE_SPEC(node_id, prop, idx) \
@@ -273,20 +492,45 @@ static int calc_init(const struct device *dev)
 		calc_res_num_##id,					\
 	};								\
 									\
+	BUILD_ASSERT(_CALC_NUM_VALUES(id) <= 64,			\
+		     "Too many values to track changes");		\
+									\
 	static void calc_func_##id(const struct value_dt_spec *values,	\
-				   uint8_t *ready,			\
-				   value_t *results)			\
+				   struct calc_data *data)		\
 	{								\
+		static value_t _last_vals[_CALC_NUM_VALUES(id)];	\
+		static int _last_rcs[_CALC_NUM_VALUES(id)];		\
+		uint8_t *ready = data->ready;				\
+		value_t *results = data->results;			\
+		value_t _vals[_CALC_NUM_VALUES(id)];			\
+		int _rcs[_CALC_NUM_VALUES(id)];				\
+		uint64_t _changed;					\
+									\
 		DT_INST_FOREACH_PROP_ELEM(id, values, _CALC_VALUE_DEF);	\
 		DT_INST_FOREACH_CHILD(id, _CALC_RES_DEF);		\
+		DT_INST_FOREACH_CHILD(id, _CALC_OP_DEF);		\
+		DT_INST_FOREACH_CHILD(id, _CALC_DEPS_DEF);		\
 									\
+		value_get_many_dt(values, _vals, _rcs,			\
+				  _CALC_NUM_VALUES(id));		\
 		DT_INST_FOREACH_PROP_ELEM(id, values, _CALC_VALUE_GET);	\
+									\
+		_changed = calc_changes(_vals, _rcs, _last_vals,	\
+					_last_rcs,			\
+					_CALC_NUM_VALUES(id));		\
+		if (data->recalc) {					\
+			/* also operations with constant arguments */	\
+			_changed = UINT64_MAX;				\
+			data->recalc = false;				\
+		}							\
+									\
 		DT_INST_FOREACH_CHILD(id, _CALC_OP_IMPL);		\
 	}								\
 									\
 	static CALC_DATA_STRUCT(, _CALC_NUM_RESULTS(id))		\
 	calc_data_##id = {						\
 		.active = DT_INST_PROP(id, initial_active),		\
+		.recalc = true,						\
 	};								\
 									\
 	static const CALC_CONFIG_STRUCT(, _CALC_NUM_VALUES(id))		\
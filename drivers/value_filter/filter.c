@@ -6,6 +6,7 @@
 
 #include <zephyr/device.h>
 #include <zephyr/drivers/value.h>
+#include <zephyr/drivers/value_workq.h>
 #include <zephyr/dt-bindings/value/filter.h>
 #include <zephyr/fixed_point.h>
 #include <zephyr/logging/log.h>
@@ -52,57 +53,350 @@ LOG_MODULE_REGISTER(filter, CONFIG_VALUE_FILTER_LOG_LEVEL);
 
 #endif /* IS_ENABLED(CONFIG_VALUE_FILTER_SETTINGS) */
 
-struct filter_param {
-	value_t alpha;
-	value_t one_minus_alpha;
+#if IS_ENABLED(CONFIG_VALUE_FILTER_WARM_START)
+
+/* name of state snapshot within settings of instance */
+#define FILTER_WARM_NAME "state"
+
+#define FILTER_WARM_DATA_FIELDS			  \
+	/* periodic snapshot work */		  \
+	struct k_work_delayable warm_work;	  \
+	/* pointer to device (needed for work) */ \
+	const struct device *dev;		  \
+	/* state is restored and not activated */ \
+	bool warm_restored;
+
+#define FILTER_WARM_CONFIG_FIELDS				\
+	/* settings name of snapshot (NULL when not used) */	\
+	const char *warm_name;					\
+	/* clock in seconds (NULL to use uptime) */		\
+	const struct value_dt_spec *warm_clock;			\
+	/* snapshot period in seconds (0 - on shutdown only) */	\
+	uint32_t warm_period;					\
+	/* maximum age of snapshot in seconds */		\
+	uint32_t warm_max_age;
+
+#define _HAS_WARM_START(id) \
+	DT_INST_PROP(id, warm_start)
+
+#define _HAS_WARM_CLOCK(id) \
+	DT_INST_NODE_HAS_PROP(id, warm_start_clock)
+
+#define FILTER_WARM_DEFINE(id)							    \
+	BUILD_ASSERT(!_HAS_WARM_START(id) ||					    \
+		     (DT_INST_ENUM_IDX(id, filter_type) == 0 &&			    \
+		      !DT_INST_NODE_HAS_PROP(id, outlier_rate)),		    \
+		     "Warm start is supported by EMA filter without outlier-rate"); \
+	IF_ENABLED(UTIL_AND(_HAS_WARM_START(id), _HAS_WARM_CLOCK(id)),		    \
+		   (static const struct value_dt_spec filter_warm_clock_##id =	    \
+			    VALUE_DT_SPEC_INST_GET_BY_IDX(id, warm_start_clock, 0);))
+
+#define FILTER_WARM_CONFIG_FIELDS_INIT(id)				      \
+	IF_ENABLED(_HAS_WARM_START(id),					      \
+		   (.warm_name = FILTER_SETTINGS_INST_NAME(id)		      \
+				 "/" FILTER_WARM_NAME,			      \
+		    .warm_clock = COND_CODE_1(_HAS_WARM_CLOCK(id),	      \
+					      (&filter_warm_clock_##id),      \
+					      (NULL)),			      \
+		    .warm_period = DT_INST_PROP_OR(id, warm_start_period, 0), \
+		    .warm_max_age = DT_INST_PROP(id, warm_start_max_age),))
+
+#else /* !IS_ENABLED(CONFIG_VALUE_FILTER_WARM_START) */
+
+#define FILTER_WARM_DATA_FIELDS
+#define FILTER_WARM_CONFIG_FIELDS
+#define FILTER_WARM_DEFINE(id)
+#define FILTER_WARM_CONFIG_FIELDS_INIT(id)
+
+#endif /* IS_ENABLED(CONFIG_VALUE_FILTER_WARM_START) */
+
+#define FLAG_WORDS DIV_ROUND_UP(CONFIG_VALUE_FILTER_MAX_VALUES, 32)
+
+#define FILTER_DATA_STRUCT(type_name, num_values)    \
+	struct type_name {			     \
+		FILTER_WARM_DATA_FIELDS		     \
+		bool active;			     \
+		/* synchronizations since publish */ \
+		uint16_t phase;			     \
+		/* number of publishes */	     \
+		uint32_t sequence;		     \
+		/* number of rejected samples */     \
+		uint32_t rejected;		     \
+		uint32_t ready[FLAG_WORDS];	     \
+		uint32_t fault[FLAG_WORDS];	     \
+		/* flags of published outputs */     \
+		uint32_t out_ready[FLAG_WORDS];	     \
+		uint32_t out_fault[FLAG_WORDS];	     \
+		value_t values[num_values];	     \
+	}
+
+FILTER_DATA_STRUCT(filter_data, 0);
+
+/* filter all values which inputs is ok */
+typedef void filter_calc(const struct device *dev, const value_t *inputs,
+			 const uint32_t *ok);
+
+/* replace outliers of values which inputs is ok, get number of rejected */
+typedef unsigned filter_reject(const struct device *dev, value_t *inputs,
+			       const uint32_t *ok);
+
+/* filter single value */
+typedef value_t filter_kernel(unsigned idx, value_t value, bool ready);
+
+/* window of the last samples of channel */
+struct filter_window {
+	/* running sum of samples */
+	int64_t sum;
+	/* position of the oldest sample in ring */
+	uint16_t head;
+	/* number of samples in window */
+	uint16_t count;
+};
+
+/* state of second-order section (Direct Form I) */
+struct filter_biquad {
+	value_t x1;
+	value_t x2;
+	value_t y1;
+	value_t y2;
 };
 
-#define MAX_FLAG_BYTES ((CONFIG_VALUE_FILTER_MAX_VALUES * 2 + 7) / 8)
+/* indexes of biquad coefficients */
+enum {
+	FILTER_B0,
+	FILTER_B1,
+	FILTER_B2,
+	FILTER_A1,
+	FILTER_A2,
+};
 
-#define FILTER_DATA_STRUCT(type_name, num_values) \
-	struct type_name {			  \
-		struct filter_param param;	  \
-		bool active;			  \
-		uint8_t flags[MAX_FLAG_BYTES];	  \
-		value_t values[num_values];	  \
+#define FILTER_CONFIG_STRUCT(type_name, num_values_)			   \
+	struct type_name {						   \
+		FILTER_SETTINGS_CONFIG_FIELDS				   \
+		FILTER_WARM_CONFIG_FIELDS				   \
+		filter_calc *calculate;					   \
+		/* outlier rejection (NULL when not used) */		   \
+		filter_reject *reject;					   \
+		/* parameters of channels */				   \
+		value_t *alphas;					   \
+		value_t *one_minus_alphas;				   \
+		const value_t *default_alphas;				   \
+		/* samples left to boost alpha (NULL when not adaptive) */ \
+		uint16_t *boosts;					   \
+		/* published outputs (NULL when not decimated) */	   \
+		value_t *outputs;					   \
+		/* sums of values to average (NULL when not used) */	   \
+		int64_t *sums;						   \
+		/* numbers of ready values in sums */			   \
+		uint16_t *counts;					   \
+		uint16_t decimation;					   \
+		value_t period;						   \
+		value_t param_scale;					   \
+		uint16_t num_values;					   \
+		struct value_dt_spec values[num_values_];		   \
 	}
 
-FILTER_DATA_STRUCT(filter_data, 0);
+FILTER_CONFIG_STRUCT(filter_config, 0);
+
+static int filter_set_alpha(const struct device *dev, unsigned chn, value_t alpha);
+
+#if IS_ENABLED(CONFIG_VALUE_FILTER_WARM_START)
 
-typedef value_t filter_calc(const struct filter_param *param,
-			    value_t value, value_t prev_value,
-			    bool ready);
+/* header of filter state snapshot followed by values */
+struct filter_snapshot {
+	/* time when taken (seconds of clock or uptime) */
+	int64_t time;
+	uint32_t ready[FLAG_WORDS];
+	uint16_t num_values;
+	/* taken by FILTER_STATE_SAVE command on shutdown */
+	bool shutdown;
+};
+
+static int filter_warm_time(const struct device *dev, int64_t *ptime)
+{
+	const struct filter_config *cfg = dev->config;
+	value_t now;
+	int rc;
+
+	if (cfg->warm_clock == NULL) {
+		*ptime = k_uptime_get() / MSEC_PER_SEC;
+		return 0;
+	}
 
-#define FILTER_CONFIG_STRUCT(type_name, num_values_)	  \
-	struct type_name {				  \
-		FILTER_SETTINGS_CONFIG_FIELDS		  \
-		filter_calc *calculate;			  \
-		value_t default_alpha;			  \
-		value_t period;				  \
-		value_t param_scale;			  \
-		uint16_t num_values;			  \
-		struct value_dt_spec values[num_values_]; \
+	rc = value_get_dt(cfg->warm_clock, &now);
+	if (rc == 0) {
+		*ptime = now;
 	}
 
-FILTER_CONFIG_STRUCT(filter_config, 0);
+	return rc;
+}
 
-#if IS_ENABLED(CONFIG_VALUE_FILTER_SETTINGS)
+/* save values with flags in single write */
+static int filter_state_save(const struct device *dev, bool shutdown)
+{
+	const struct filter_config *cfg = dev->config;
+	struct filter_data *data = dev->data;
+	uint8_t buf[sizeof(struct filter_snapshot) + cfg->num_values * sizeof(value_t)];
+	struct filter_snapshot snap = {
+		.num_values = cfg->num_values,
+		.shutdown = shutdown,
+	};
+	int rc;
+
+	if (cfg->warm_name == NULL) {
+		LOG_ERR("%s: Warm start is not configured", dev->name);
+		return -ENOTSUP;
+	}
+
+	rc = filter_warm_time(dev, &snap.time);
+	if (rc < 0) {
+		LOG_WRN("%s: Unable to get snapshot time: %d", dev->name, rc);
+		return rc;
+	}
+
+	memcpy(snap.ready, data->ready, sizeof(snap.ready));
+	memcpy(buf, &snap, sizeof(snap));
+	memcpy(&buf[sizeof(snap)], data->values, cfg->num_values * sizeof(value_t));
+
+	rc = settings_save_one(cfg->warm_name, buf, sizeof(buf));
+	if (rc < 0) {
+		LOG_WRN("%s: Save filter state failed: %d", dev->name, rc);
+		return rc;
+	}
+
+	if (shutdown) {
+		/* keep shutdown snapshot until reboot */
+		k_work_cancel_delayable(&data->warm_work);
+	}
+
+	return 0;
+}
 
-static int filter_set_alpha(const struct device *dev, value_t alpha);
+/* restore values with flags unless snapshot is stale */
+static int filter_state_restore(const struct device *dev, size_t len,
+				settings_read_cb read_cb, void *cb_arg)
+{
+	const struct filter_config *cfg = dev->config;
+	struct filter_data *data = dev->data;
+	uint8_t buf[sizeof(struct filter_snapshot) + cfg->num_values * sizeof(value_t)];
+	struct filter_snapshot snap;
+	int64_t now;
+	int rc;
+
+	if (cfg->warm_name == NULL || data->sequence > 0) {
+		/* not used or filter is already running */
+		return 0;
+	}
+
+	if (len != sizeof(buf)) {
+		LOG_WRN("%s: Saved filter state mismatch", dev->name);
+		return -EINVAL;
+	}
+
+	rc = read_cb(cb_arg, buf, len);
+	if (rc < 0) {
+		return rc;
+	}
+
+	memcpy(&snap, buf, sizeof(snap));
+
+	if (snap.num_values != cfg->num_values) {
+		LOG_WRN("%s: Saved filter state mismatch", dev->name);
+		return -EINVAL;
+	}
+
+	/* without clock the downtime is known to be short after shutdown only */
+	if (cfg->warm_clock == NULL ? !snap.shutdown :
+	    filter_warm_time(dev, &now) < 0 || now < snap.time ||
+	    now - snap.time > cfg->warm_max_age) {
+		LOG_INF("%s: Saved filter state is stale", dev->name);
+		return 0;
+	}
+
+	memcpy(data->values, &buf[sizeof(snap)], cfg->num_values * sizeof(value_t));
+	memcpy(data->ready, snap.ready, sizeof(data->ready));
+	data->warm_restored = true;
+
+	return 0;
+}
+
+/*
+ * Periodic snapshot is saved in system work queue to keep the flash writes
+ * out of value work queue. The values can be updated while copied, so the
+ * snapshot can mix values of adjacent synchronizations.
+ */
+static void filter_warm_work(struct k_work *work)
+{
+	struct k_work_delayable *kwd = k_work_delayable_from_work(work);
+	struct filter_data *data = CONTAINER_OF(kwd, struct filter_data, warm_work);
+	const struct filter_config *cfg = data->dev->config;
+
+	if (data->active) {
+		filter_state_save(data->dev, false);
+	}
+
+	k_work_schedule(kwd, K_SECONDS(cfg->warm_period));
+}
+
+static void filter_warm_init(const struct device *dev)
+{
+	const struct filter_config *cfg = dev->config;
+	struct filter_data *data = dev->data;
+
+	if (cfg->warm_name == NULL) {
+		return;
+	}
+
+	/* snapshot is used once */
+	settings_delete(cfg->warm_name);
+
+	data->dev = dev;
+	k_work_init_delayable(&data->warm_work, filter_warm_work);
+
+	if (cfg->warm_period > 0) {
+		k_work_schedule(&data->warm_work, K_SECONDS(cfg->warm_period));
+	}
+}
+
+#endif /* IS_ENABLED(CONFIG_VALUE_FILTER_WARM_START) */
+
+#if IS_ENABLED(CONFIG_VALUE_FILTER_SETTINGS)
 
 static int filter_settings_set(const char *name, size_t len,
 			       settings_read_cb read_cb, void *cb_arg,
 			       const struct device *dev)
 {
-	value_t alpha;
+	const struct filter_config *cfg = dev->config;
+	value_t alphas[cfg->num_values];
+	unsigned idx;
 	int rc;
 
-	rc = read_cb(cb_arg, &alpha, sizeof(alpha));
-	if (rc >= 0) {
-		return filter_set_alpha(dev, alpha);
+#if IS_ENABLED(CONFIG_VALUE_FILTER_WARM_START)
+	if (name != NULL && settings_name_steq(name, FILTER_WARM_NAME, NULL)) {
+		return filter_state_restore(dev, len, read_cb, cb_arg);
 	}
+#endif /* IS_ENABLED(CONFIG_VALUE_FILTER_WARM_START) */
 
-	return rc;
+	/* either alphas of all channels or single alpha for all */
+	if (len != sizeof(alphas) && len != sizeof(alphas[0])) {
+		LOG_WRN("%s: Saved filter parameters mismatch", dev->name);
+		return -EINVAL;
+	}
+
+	rc = read_cb(cb_arg, alphas, len);
+	if (rc < 0) {
+		return rc;
+	}
+
+	for (idx = 0; idx < cfg->num_values; idx++) {
+		rc = filter_set_alpha(dev, idx,
+				      alphas[len == sizeof(alphas) ? idx : 0]);
+		if (rc < 0) {
+			return rc;
+		}
+	}
+
+	return 0;
 }
 
 static inline int filter_param_load(const struct device *dev)
@@ -121,13 +415,22 @@ static inline int filter_param_load(const struct device *dev)
 static inline int filter_param_save(const struct device *dev)
 {
 	const struct filter_config *cfg = dev->config;
-	struct filter_data *data = dev->data;
+	value_t alphas[cfg->num_values];
+	bool is_default = true;
+	unsigned idx;
 	int rc;
 
+	/* save parameters of all channels in single blob */
+	for (idx = 0; idx < cfg->num_values; idx++) {
+		alphas[idx] = cfg->alphas[idx];
+		if (alphas[idx] != cfg->default_alphas[idx]) {
+			is_default = false;
+		}
+	}
+
 	rc = settings_save_one(cfg->settings_name,
-			       data->param.alpha != cfg->default_alpha ?
-			       &data->param.alpha : NULL,
-			       sizeof(data->param.alpha));
+			       is_default ? NULL : alphas,
+			       sizeof(alphas));
 
 	if (rc < 0) {
 		LOG_WRN("Save filter parameter failed: %d", rc);
@@ -141,100 +444,585 @@ static inline int filter_param_save(const struct device *dev)
 static inline void filter_param_reset(const struct device *dev)
 {
 	const struct filter_config *cfg = dev->config;
-	struct filter_data *data = dev->data;
+	unsigned idx;
 
-	data->param.alpha = cfg->default_alpha;
+	for (idx = 0; idx < cfg->num_values; idx++) {
+		filter_set_alpha(dev, idx, cfg->default_alphas[idx]);
+	}
 }
 
-static inline bool is_ready(const uint8_t *data, unsigned bit)
+static inline bool is_flag(const uint32_t *flags, unsigned bit)
 {
-	return (data[bit / 4] >> ((bit % 4) * 2)) & 1;
+	return (flags[bit / 32] >> (bit % 32)) & 1;
 }
 
-static inline void set_ready(uint8_t *data, unsigned bit)
+static inline void reset_flags(uint32_t *flags)
 {
-	data[bit / 4] |= 1 << ((bit % 4) * 2);
+	memset(flags, 0, FLAG_WORDS * sizeof(flags[0]));
 }
 
-static inline void reset_ready(uint8_t *data, unsigned bit)
+static inline void filter_window_reset(struct filter_window *win)
 {
-	data[bit / 4] &= ~(1 << ((bit % 4) * 2));
+	win->sum = 0;
+	win->head = 0;
+	win->count = 0;
 }
 
-static inline bool is_fault(const uint8_t *data, unsigned bit)
+/* put sample to ring and get evicted one */
+static inline value_t filter_window_push(struct filter_window *win, value_t *ring,
+					 uint16_t length, value_t value)
 {
-	return (data[bit / 4] >> ((bit % 4) * 2)) & 2;
+	value_t oldest = ring[win->head];
+
+	ring[win->head] = value;
+
+	if (++win->head == length) {
+		win->head = 0;
+	}
+
+	return oldest;
 }
 
-static inline void set_fault(uint8_t *data, unsigned bit)
+/* moving average using running sum */
+static value_t filter_moving_average(struct filter_window *win, value_t *ring,
+				     uint16_t length, value_t value, bool ready)
 {
-	data[bit / 4] |= 2 << ((bit % 4) * 2);
+	value_t oldest;
+
+	if (!ready) {
+		filter_window_reset(win);
+	}
+
+	oldest = filter_window_push(win, ring, length, value);
+
+	if (win->count == length) {
+		win->sum -= oldest;
+	} else {
+		win->count++;
+	}
+
+	win->sum += value;
+
+	return win->sum / win->count;
 }
 
-static inline void reset_fault(uint8_t *data, unsigned bit)
+/* find position of the first sample which is not less than value */
+static size_t filter_sorted_search(const value_t *sorted, size_t num, value_t value)
 {
-	data[bit / 4] &= ~(2 << ((bit % 4) * 2));
+	size_t lo = 0;
+	size_t mid;
+
+	while (lo < num) {
+		mid = (lo + num) / 2;
+		if (sorted[mid] < value) {
+			lo = mid + 1;
+		} else {
+			num = mid;
+		}
+	}
+
+	return lo;
 }
 
-static inline void reset_flags(uint8_t *data)
+/* maximum window of median filter (shifts of sorted copy is O(n)) */
+#define FILTER_MEDIAN_MAX_WINDOW 64
+
+/*
+ * running median using sorted copy of window
+ *
+ * The positions of evicted and inserted samples is found by binary search,
+ * but the samples between is shifted, so the time is O(n) per sample.
+ */
+static value_t filter_median(struct filter_window *win, value_t *ring, value_t *sorted,
+			     uint16_t length, value_t value, bool ready)
 {
-	memset(data, 0, MAX_FLAG_BYTES);
+	value_t oldest;
+	size_t pos;
+
+	if (!ready) {
+		filter_window_reset(win);
+	}
+
+	oldest = filter_window_push(win, ring, length, value);
+
+	if (win->count == length) {
+		/* evict the oldest sample */
+		pos = filter_sorted_search(sorted, win->count, oldest);
+		win->count--;
+		memmove(&sorted[pos], &sorted[pos + 1],
+			(win->count - pos) * sizeof(sorted[0]));
+	}
+
+	/* insert the new sample */
+	pos = filter_sorted_search(sorted, win->count, value);
+	memmove(&sorted[pos + 1], &sorted[pos],
+		(win->count - pos) * sizeof(sorted[0]));
+	sorted[pos] = value;
+	win->count++;
+
+	return win->count % 2 ?
+	       sorted[win->count / 2] :
+	       ((int64_t)sorted[win->count / 2 - 1] + sorted[win->count / 2]) / 2;
 }
 
-static void filter_task(const struct device *dev)
+/* second-order IIR section with coefficients scaled by param scale */
+static value_t filter_biquad(struct filter_biquad *state, const value_t *coefs,
+			     value_t param_scale, value_t value, bool ready)
+{
+	int64_t den;
+	int64_t acc;
+
+	if (!ready) {
+		/* start from steady state */
+		den = (int64_t)param_scale + coefs[FILTER_A1] + coefs[FILTER_A2];
+		state->x1 = state->x2 = value;
+		state->y1 = state->y2 = den != 0 ?
+					(int64_t)value * ((int64_t)coefs[FILTER_B0] +
+							  coefs[FILTER_B1] +
+							  coefs[FILTER_B2]) / den :
+					0;
+	}
+
+	acc = (int64_t)coefs[FILTER_B0] * value +
+	      (int64_t)coefs[FILTER_B1] * state->x1 +
+	      (int64_t)coefs[FILTER_B2] * state->x2 -
+	      (int64_t)coefs[FILTER_A1] * state->y1 -
+	      (int64_t)coefs[FILTER_A2] * state->y2;
+
+	state->x2 = state->x1;
+	state->x1 = value;
+	state->y2 = state->y1;
+	state->y1 = acc / param_scale;
+
+	return state->y1;
+}
+
+/* sort few samples in place */
+static inline void filter_sort(value_t *samples, size_t num)
+{
+	value_t sample;
+	size_t idx;
+	size_t pos;
+
+	for (idx = 1; idx < num; idx++) {
+		sample = samples[idx];
+		for (pos = idx; pos > 0 && samples[pos - 1] > sample; pos--) {
+			samples[pos] = samples[pos - 1];
+		}
+		samples[pos] = sample;
+	}
+}
+
+/*
+ * Hampel identifier over window of the last samples
+ *
+ * The sample which deviates from the median of window more than threshold
+ * times scaled MAD (median absolute deviation) is replaced by median.
+ * The window is short and statically sized, so the time is constant.
+ *
+ * The MAD is at least one unit and deviations up to min_deviation are
+ * always accepted, so flat windows of quantized samples do not reject
+ * small real steps.
+ */
+static bool filter_hampel(struct filter_window *win, value_t *ring, uint16_t length,
+			  value_t threshold, value_t min_deviation, value_t param_scale,
+			  value_t *value, bool ready)
+{
+	value_t sorted[length];
+	value_t median;
+	value_t mad;
+	int64_t deviation;
+	unsigned idx;
+
+	if (!ready) {
+		filter_window_reset(win);
+	}
+
+	filter_window_push(win, ring, length, *value);
+
+	if (win->count < length) {
+		/* do not reject until window is filled */
+		win->count++;
+		return false;
+	}
+
+	memcpy(sorted, ring, sizeof(sorted));
+	filter_sort(sorted, length);
+	median = sorted[length / 2];
+
+	/* deviations of sorted samples from median */
+	for (idx = 0; idx < length; idx++) {
+		sorted[idx] = sorted[idx] < median ? median - sorted[idx] : sorted[idx] - median;
+	}
+	filter_sort(sorted, length);
+	mad = MAX(sorted[length / 2], 1);
+
+	deviation = (int64_t)*value - median;
+	if (deviation < 0) {
+		deviation = -deviation;
+	}
+
+	if (deviation <= min_deviation ||
+	    deviation * param_scale <= (int64_t)threshold * mad) {
+		return false;
+	}
+
+	*value = median;
+	return true;
+}
+
+/* limit change of value between samples */
+static inline bool filter_rate_clamp(value_t *last, value_t rate, value_t *value, bool ready)
+{
+	int64_t delta = (int64_t)*value - *last;
+
+	if (!ready || (delta <= rate && delta >= -rate)) {
+		*last = *value;
+		return false;
+	}
+
+	*last += delta > 0 ? rate : -rate;
+	*value = *last;
+	return true;
+}
+
+/*
+ * EMA of all values in single branch-free pass
+ *
+ * Inlined into filter of each instance, so the scales are constants
+ * and the loop can be vectorized by compiler.
+ *
+ * In adaptive mode (adaptive_samples > 0) alpha is boosted up to 1 when
+ * the difference between input and previous value exceeds noise band,
+ * the boost decays back to alpha linearly over adaptive_samples samples.
+ */
+static ALWAYS_INLINE void filter_ema_pass(const struct device *dev, const value_t *inputs,
+					  const uint32_t *ok, int32_t input_scale,
+					  int32_t output_scale, int32_t param_scale,
+					  int32_t adaptive_band, uint16_t adaptive_samples)
+{
+	const struct filter_config *cfg = dev->config;
+	struct filter_data *data = dev->data;
+	const value_t *restrict in = inputs;
+	const value_t *restrict alphas = cfg->alphas;
+	const value_t *restrict one_minus_alphas = cfg->one_minus_alphas;
+	value_t *restrict values = data->values;
+	uint16_t *restrict boosts = cfg->boosts;
+	unsigned base;
+	unsigned num;
+	unsigned idx;
+	uint32_t ok_word;
+	uint32_t ready_word;
+	int64_t input;
+	int64_t value;
+	int64_t prev_value;
+	int64_t alpha;
+	uint16_t boost;
+
+	/* by words of flags, so the flags are not gathered for each value */
+	for (base = 0; base < cfg->num_values; base += 32) {
+		ok_word = ok[base / 32];
+		ready_word = data->ready[base / 32];
+		num = MIN(cfg->num_values - base, 32);
+
+		for (idx = 0; idx < num; idx++) {
+			input = (int64_t)in[base + idx] * output_scale / input_scale;
+			prev_value = values[base + idx];
+			/* keep value when input failed */
+			value = (ok_word >> idx) & 1 ? input : prev_value;
+			/* start from input when not ready */
+			prev_value = (ready_word >> idx) & 1 ? prev_value : value;
+
+			if (adaptive_samples > 0) {
+				boost = boosts[base + idx];
+				/* restart boost on step, decay otherwise */
+				boost = value - prev_value > adaptive_band ||
+					prev_value - value > adaptive_band ?
+					adaptive_samples : boost > 0 ? boost - 1 : 0;
+				boosts[base + idx] = boost;
+
+				alpha = alphas[base + idx] +
+					(int64_t)one_minus_alphas[base + idx] * boost /
+					adaptive_samples;
+
+				values[base + idx] = (value * alpha +
+						      prev_value * (param_scale - alpha)) /
+						     param_scale;
+				continue;
+			}
+
+			values[base + idx] = (value * alphas[base + idx] +
+					      prev_value * one_minus_alphas[base + idx]) /
+					     param_scale;
+		}
+	}
+}
+
+/* filter values one by one using kernel with state */
+static ALWAYS_INLINE void filter_kernel_pass(const struct device *dev, const value_t *inputs,
+					     const uint32_t *ok, int32_t input_scale,
+					     int32_t output_scale, filter_kernel *kernel)
 {
 	const struct filter_config *cfg = dev->config;
 	struct filter_data *data = dev->data;
-	value_t value;
 	unsigned idx;
-	int rc;
 
 	for (idx = 0; idx < cfg->num_values; idx++) {
-		rc = value_get_dt(&cfg->values[idx], &value);
-		if (rc != 0) {
-			reset_ready(data->flags, idx);
-			if (rc != -EAGAIN) {
-				set_fault(data->flags, idx);
+		if (is_flag(ok, idx)) {
+			data->values[idx] = kernel(idx, (int64_t)inputs[idx] *
+						   output_scale / input_scale,
+						   is_flag(data->ready, idx));
+		}
+	}
+}
+
+/* publish outputs every Nth synchronization */
+static void filter_decimate(const struct device *dev)
+{
+	const struct filter_config *cfg = dev->config;
+	struct filter_data *data = dev->data;
+	unsigned idx;
+
+	if (cfg->sums != NULL) {
+		/* values which failed to update is not averaged */
+		for (idx = 0; idx < cfg->num_values; idx++) {
+			if (is_flag(data->ready, idx) && !is_flag(data->fault, idx)) {
+				cfg->sums[idx] += data->values[idx];
+				cfg->counts[idx]++;
 			}
-			continue;
 		}
+	}
+
+	if (++data->phase < cfg->decimation) {
+		return;
+	}
 
-		data->values[idx] = cfg->calculate(&data->param, value,
-						   data->values[idx],
-						   is_ready(data->flags, idx));
-		set_ready(data->flags, idx);
-		reset_fault(data->flags, idx);
+	data->phase = 0;
+
+	memcpy(data->out_fault, data->fault, sizeof(data->out_fault));
+
+	if (cfg->sums != NULL) {
+		/* boxcar average of ready values since previous publish */
+		reset_flags(data->out_ready);
+		for (idx = 0; idx < cfg->num_values; idx++) {
+			if (cfg->counts[idx] > 0) {
+				cfg->outputs[idx] = cfg->sums[idx] / cfg->counts[idx];
+				data->out_ready[idx / 32] |= BIT(idx % 32);
+			}
+			cfg->sums[idx] = 0;
+			cfg->counts[idx] = 0;
+		}
+	} else {
+		memcpy(cfg->outputs, data->values, cfg->num_values * sizeof(cfg->outputs[0]));
+		memcpy(data->out_ready, data->ready, sizeof(data->out_ready));
 	}
+
+	data->sequence++;
 }
 
-static int filter_value_get(const struct device *dev, value_id_t id, value_t *pval)
+/* reject outliers of values one by one using Hampel identifier */
+static ALWAYS_INLINE unsigned filter_hampel_pass(const struct device *dev, value_t *inputs,
+						 const uint32_t *ok, struct filter_window *wins,
+						 value_t *rings, uint16_t length,
+						 value_t threshold, value_t min_deviation,
+						 value_t param_scale)
 {
 	const struct filter_config *cfg = dev->config;
 	struct filter_data *data = dev->data;
-	int rc = 0;
+	unsigned rejected = 0;
+	unsigned idx;
 
-	switch (id) {
-	case FILTER_STATE:
-		*pval = data->active;
-		break;
+	for (idx = 0; idx < cfg->num_values; idx++) {
+		if (is_flag(ok, idx)) {
+			rejected += filter_hampel(&wins[idx], &rings[idx * length], length,
+						  threshold, min_deviation, param_scale,
+						  &inputs[idx],
+						  is_flag(data->ready, idx));
+		}
+	}
+
+	return rejected;
+}
+
+/* reject outliers of values one by one using rate clamp */
+static ALWAYS_INLINE unsigned filter_rate_pass(const struct device *dev, value_t *inputs,
+					       const uint32_t *ok, value_t *lasts, value_t rate)
+{
+	const struct filter_config *cfg = dev->config;
+	struct filter_data *data = dev->data;
+	unsigned rejected = 0;
+	unsigned idx;
+
+	for (idx = 0; idx < cfg->num_values; idx++) {
+		if (is_flag(ok, idx)) {
+			rejected += filter_rate_clamp(&lasts[idx], rate, &inputs[idx],
+						      is_flag(data->ready, idx));
+		}
+	}
+
+	return rejected;
+}
 
+static void filter_task(const struct device *dev)
+{
+	const struct filter_config *cfg = dev->config;
+	struct filter_data *data = dev->data;
+	value_t inputs[cfg->num_values];
+	int rcs[cfg->num_values];
+	uint32_t ok[FLAG_WORDS] = { 0 };
+	uint32_t err[FLAG_WORDS] = { 0 };
+	unsigned idx;
+
+	/* get all input values at once */
+	value_get_many_dt(cfg->values, inputs, rcs, cfg->num_values);
+
+	for (idx = 0; idx < cfg->num_values; idx++) {
+		ok[idx / 32] |= (uint32_t)(rcs[idx] == 0) << (idx % 32);
+		err[idx / 32] |= (uint32_t)(rcs[idx] != 0 && rcs[idx] != -EAGAIN) << (idx % 32);
+	}
+
+	if (cfg->reject != NULL) {
+		/* replace spikes before smoothing */
+		data->rejected += cfg->reject(dev, inputs, ok);
+	}
+
+	cfg->calculate(dev, inputs, ok);
+
+	/* failed values is not ready, fault is kept until the next success */
+	for (idx = 0; idx < FLAG_WORDS; idx++) {
+		data->ready[idx] = ok[idx];
+		data->fault[idx] = (data->fault[idx] & ~ok[idx]) | err[idx];
+	}
+
+	if (cfg->outputs != NULL) {
+		filter_decimate(dev);
+	} else {
+		data->sequence++;
+	}
+}
+
+static inline int filter_output_get(const struct device *dev, unsigned idx, value_t *pval)
+{
+	const struct filter_config *cfg = dev->config;
+	struct filter_data *data = dev->data;
+	bool decimated = cfg->outputs != NULL;
+
+	*pval = decimated ? cfg->outputs[idx] : data->values[idx];
+
+	if (is_flag(decimated ? data->out_fault : data->fault, idx)) {
+		return -EFAULT;
+	}
+	if (!is_flag(decimated ? data->out_ready : data->ready, idx)) {
+		return -EAGAIN;
+	}
+
+	return 0;
+}
+
+static inline bool filter_is_param(value_id_t id)
+{
+	return FILTER_PARAM_ID(id) == FILTER_ALPHA ||
+	       FILTER_PARAM_ID(id) == FILTER_SAMPLES ||
+	       FILTER_PARAM_ID(id) == FILTER_WINDOW;
+}
+
+/* get parameter of channel (of the first one when not specified) */
+static int filter_param_get(const struct device *dev, value_id_t id, value_t *pval)
+{
+	const struct filter_config *cfg = dev->config;
+	unsigned chn = FILTER_PARAM_CHANNEL(id);
+	value_t alpha;
+
+	if (chn > cfg->num_values) {
+		LOG_ERR("%s: attempt to get parameter of unknown channel #%u",
+			dev->name, chn - 1);
+		return -EINVAL;
+	}
+
+	alpha = cfg->alphas[chn > 0 ? chn - 1 : 0];
+
+	switch (FILTER_PARAM_ID(id)) {
 	case FILTER_ALPHA:
-		*pval = data->param.alpha;
+		*pval = alpha;
 		break;
 
 	case FILTER_SAMPLES:
 		/* get number of smoothing samples from alpha using formula: 2 / alpha - 1 */
 		*pval = (value_t)((int64_t)cfg->param_scale *
 				  (int64_t)cfg->param_scale * 2 /
-				  data->param.alpha) - cfg->param_scale;
+				  alpha) - cfg->param_scale;
 		break;
 
-	case FILTER_WINDOW:
+	default:
 		/* get swoothing time window from alpha using formula: (2 / alpha - 1) * period */
 		*pval = (int64_t)((value_t)((int64_t)cfg->param_scale *
 					    (int64_t)cfg->param_scale * 2 /
-					    data->param.alpha) - cfg->param_scale) *
+					    alpha) - cfg->param_scale) *
 			cfg->period / cfg->param_scale;
+	}
+
+	return 0;
+}
+
+/* set parameter of channel (of all channels when not specified) */
+static int filter_param_set(const struct device *dev, value_id_t id, value_t val)
+{
+	const struct filter_config *cfg = dev->config;
+	unsigned chn = FILTER_PARAM_CHANNEL(id);
+	value_t alpha;
+	unsigned idx;
+	int rc;
+
+	if (chn > cfg->num_values) {
+		LOG_ERR("%s: attempt to set parameter of unknown channel #%u",
+			dev->name, chn - 1);
+		return -EINVAL;
+	}
+
+	switch (FILTER_PARAM_ID(id)) {
+	case FILTER_ALPHA:
+		alpha = val;
+		break;
+
+	case FILTER_SAMPLES:
+		/* set alpha from number of smoothing samples using formula: 2 / (n + 1) */
+		alpha = (int64_t)cfg->param_scale *
+			(int64_t)cfg->param_scale * 2 /
+			(val + cfg->param_scale);
+		break;
+
+	default:
+		/* set alpha from smoothing time window using formula: 2 / (T / P + 1) */
+		alpha = (int64_t)cfg->param_scale *
+			(int64_t)cfg->param_scale * 2 /
+			((int64_t)val * cfg->param_scale /
+			 cfg->period +
+			 cfg->param_scale);
+	}
+
+	if (chn > 0) {
+		return filter_set_alpha(dev, chn - 1, alpha);
+	}
+
+	for (idx = 0; idx < cfg->num_values; idx++) {
+		rc = filter_set_alpha(dev, idx, alpha);
+		if (rc < 0) {
+			return rc;
+		}
+	}
+
+	return 0;
+}
+
+static int filter_value_get(const struct device *dev, value_id_t id, value_t *pval)
+{
+	const struct filter_config *cfg = dev->config;
+	struct filter_data *data = dev->data;
+	int rc = 0;
+
+	switch (id) {
+	case FILTER_STATE:
+		*pval = data->active;
 		break;
 
 	case FILTER_PERIOD:
@@ -245,14 +1033,22 @@ static int filter_value_get(const struct device *dev, value_id_t id, value_t *pv
 		*pval = cfg->num_values;
 		break;
 
+	case FILTER_SEQUENCE:
+		*pval = data->sequence;
+		break;
+
+	case FILTER_REJECTED:
+		*pval = data->rejected;
+		break;
+
 	default:
 		if (id < cfg->num_values) {
-			*pval = data->values[id];
-			if (is_fault(data->flags, id)) {
-				rc = -EFAULT;
-			} else if (!is_ready(data->flags, id)) {
-				rc = -EAGAIN;
-			}
+			rc = filter_output_get(dev, id, pval);
+			break;
+		}
+
+		if (filter_is_param(id)) {
+			rc = filter_param_get(dev, id, pval);
 			break;
 		}
 
@@ -263,13 +1059,31 @@ static int filter_value_get(const struct device *dev, value_id_t id, value_t *pv
 	return rc;
 }
 
-static int filter_set_alpha(const struct device *dev, value_t alpha)
+static int filter_value_get_many(const struct device *dev, const value_id_t *ids,
+				 value_t *pvals, int *rcs, size_t num)
+{
+	const struct filter_config *cfg = dev->config;
+	size_t idx;
+	int rc = 0;
+
+	for (idx = 0; idx < num; idx++) {
+		rcs[idx] = ids[idx] < cfg->num_values ?
+			   filter_output_get(dev, ids[idx], &pvals[idx]) :
+			   filter_value_get(dev, ids[idx], &pvals[idx]);
+		if (rcs[idx] != 0 && rc == 0) {
+			rc = rcs[idx];
+		}
+	}
+
+	return rc;
+}
+
+static int filter_set_alpha(const struct device *dev, unsigned chn, value_t alpha)
 {
 	const struct filter_config *cfg = dev->config;
-	struct filter_data *data = dev->data;
 
-	if (alpha == data->param.alpha) {
-		// nothing to do
+	if (alpha == cfg->alphas[chn]) {
+		/* nothing to do */
 		return 0;
 	}
 
@@ -280,8 +1094,8 @@ static int filter_set_alpha(const struct device *dev, value_t alpha)
 		return -EINVAL;
 	}
 
-	data->param.alpha = alpha;
-	data->param.one_minus_alpha = cfg->param_scale - alpha;
+	cfg->alphas[chn] = alpha;
+	cfg->one_minus_alphas[chn] = cfg->param_scale - alpha;
 
 	return 0;
 }
@@ -299,27 +1113,29 @@ static int filter_value_set(const struct device *dev, value_id_t id, value_t val
 		}
 
 		data->active = val;
-		reset_flags(data->flags);
-		break;
-
-	case FILTER_ALPHA:
-		rc = filter_set_alpha(dev, val);
-		break;
-
-	case FILTER_SAMPLES:
-		/* set alpha from number of smoothing samples using formula: 2 / (n + 1) */
-		rc = filter_set_alpha(dev, (int64_t)cfg->param_scale *
-				      (int64_t)cfg->param_scale * 2 /
-				      (val + cfg->param_scale));
+		data->phase = 0;
+#if IS_ENABLED(CONFIG_VALUE_FILTER_WARM_START)
+		/* keep restored state on the first activation */
+		if (!val || !data->warm_restored) {
+			reset_flags(data->ready);
+		}
+		data->warm_restored = false;
+#else
+		reset_flags(data->ready);
+#endif /* IS_ENABLED(CONFIG_VALUE_FILTER_WARM_START) */
+		reset_flags(data->fault);
+		reset_flags(data->out_ready);
+		reset_flags(data->out_fault);
+
+		if (cfg->sums != NULL) {
+			memset(cfg->sums, 0, cfg->num_values * sizeof(cfg->sums[0]));
+			memset(cfg->counts, 0, cfg->num_values * sizeof(cfg->counts[0]));
+		}
 		break;
 
-	case FILTER_WINDOW:
-		/* set alpha from smoothing time window using formula: 2 / (T / P + 1) */
-		rc = filter_set_alpha(dev, (int64_t)cfg->param_scale *
-				      (int64_t)cfg->param_scale * 2 /
-				      ((int64_t)val * cfg->param_scale /
-				       cfg->period +
-				       cfg->param_scale));
+	case FILTER_REJECTED:
+		/* reset counter */
+		data->rejected = val;
 		break;
 
 	case FILTER_SYNC:
@@ -340,6 +1156,11 @@ static int filter_value_set(const struct device *dev, value_id_t id, value_t val
 			rc = filter_param_save(dev);
 			break;
 #endif /* IS_ENABLED(CONFIG_VALUE_FILTER_SETTINGS) */
+#if IS_ENABLED(CONFIG_VALUE_FILTER_WARM_START)
+		case FILTER_STATE_SAVE:
+			rc = filter_state_save(dev, true);
+			break;
+#endif /* IS_ENABLED(CONFIG_VALUE_FILTER_WARM_START) */
 		case FILTER_PARAM_RESET:
 			filter_param_reset(dev);
 			break;
@@ -351,6 +1172,11 @@ static int filter_value_set(const struct device *dev, value_id_t id, value_t val
 		break;
 
 	default:
+		if (filter_is_param(id)) {
+			rc = filter_param_set(dev, id, val);
+			break;
+		}
+
 		LOG_ERR("%s: attempt to set unknown value #%d", dev->name, id);
 		rc = -EINVAL;
 	}
@@ -361,12 +1187,19 @@ static int filter_value_set(const struct device *dev, value_id_t id, value_t val
 static const struct value_driver_api filter_api = {
 	.get = filter_value_get,
 	.set = filter_value_set,
+	.get_many = filter_value_get_many,
 };
 
 static int filter_init(const struct device *dev)
 {
 #if IS_ENABLED(CONFIG_VALUE_FILTER_SETTINGS)
-	return filter_param_load(dev);
+	int rc = filter_param_load(dev);
+
+#if IS_ENABLED(CONFIG_VALUE_FILTER_WARM_START)
+	filter_warm_init(dev);
+#endif /* IS_ENABLED(CONFIG_VALUE_FILTER_WARM_START) */
+
+	return rc;
 #else /* !IS_ENABLED(CONFIG_VALUE_FILTER_SETTINGS) */
 	return 0;
 #endif /* IS_ENABLED(CONFIG_VALUE_FILTER_SETTINGS) */
@@ -376,13 +1209,9 @@ static int filter_init(const struct device *dev)
 
 #define _PARAM_SCALE(id) DT_INST_PROP(id, param_scale)
 
-/* set alpha and 1 - alpha */
-#define _SET_PARAM_ALPHA(id, alpha_)		     \
-	{					     \
-		.alpha = (alpha_),		     \
-		.one_minus_alpha =		     \
-			_PARAM_SCALE(id) - (alpha_), \
-	}
+#define _INPUT_SCALE(id) DT_INST_PROP_OR(id, input_scale, 1)
+
+#define _OUTPUT_SCALE(id) DT_INST_PROP_OR(id, output_scale, 1)
 
 /* convert number of smoothing samples to alpha using formula: 2 / (n + 1) */
 #define _SAMPLES_TO_ALPHA(id, samples)	 \
@@ -401,64 +1230,298 @@ static int filter_init(const struct device *dev)
 		    (COND_CODE_1(cond2, expr2,			      \
 				 (COND_CODE_1(cond3, expr3, def)))))
 
-#define _GET_SAMPLES_AS_ALPHA(id)			       \
-	_SAMPLES_TO_ALPHA(id,				       \
-			  FIXP_DT_INST_PROP_SCALE(id, samples, \
-						  param_scale))
-
-#define _GET_WINDOW_AS_ALPHA(id)			     \
-	_WINDOW_TO_ALPHA(id,				     \
-			 FIXP_DT_INST_PROP_SCALE(id, window, \
-						 param_scale))
-
-#define _GET_PARAM_AS_ALPHA(id)				       \
-	COND_CODE_1_X3(DT_INST_NODE_HAS_PROP(id, alpha),       \
-		       (FIXP_DT_INST_PROP_SCALE(id, alpha,     \
-						param_scale)), \
-		       DT_INST_NODE_HAS_PROP(id, samples),     \
-		       (_GET_SAMPLES_AS_ALPHA(id)),	       \
-		       DT_INST_NODE_HAS_PROP(id, window),      \
-		       (_GET_WINDOW_AS_ALPHA(id)),	       \
+/* get <numerator denominator> pair of channel or single pair for all channels */
+#define _GET_CH_PARAM(id, prop, ch)					    \
+	COND_CODE_1(DT_INST_PROP_HAS_IDX(id, prop, 2),			    \
+		    ((int64_t)DT_INST_PROP_BY_IDX(id, prop, UTIL_X2(ch)) *  \
+		     _PARAM_SCALE(id) /					    \
+		     DT_INST_PROP_BY_IDX(id, prop, UTIL_INC(UTIL_X2(ch)))), \
+		    (FIXP_DT_INST_PROP_SCALE(id, prop, param_scale)))
+
+#define _GET_CH_PARAM_AS_ALPHA(id, ch)					    \
+	COND_CODE_1_X3(DT_INST_NODE_HAS_PROP(id, alpha),		    \
+		       (_GET_CH_PARAM(id, alpha, ch)),			    \
+		       DT_INST_NODE_HAS_PROP(id, samples),		    \
+		       (_SAMPLES_TO_ALPHA(id,				    \
+					  _GET_CH_PARAM(id, samples, ch))), \
+		       DT_INST_NODE_HAS_PROP(id, window),		    \
+		       (_WINDOW_TO_ALPHA(id,				    \
+					 _GET_CH_PARAM(id, window, ch))),   \
 		       (1.0))
 
+#define _CHECK_CH_PARAM(id, prop)					\
+	BUILD_ASSERT(DT_INST_PROP_LEN_OR(id, prop, 0) <= 2 ||		\
+		     DT_INST_PROP_LEN(id, prop) == 2 * _NUM_VALUES(id),	\
+		     "Filter " #prop " should be set for all values or once")
+
+#define _DEFAULT_ALPHA(node_id, prop, idx, id) \
+	_GET_CH_PARAM_AS_ALPHA(id, idx),
+
+#define _DEFAULT_ONE_MINUS_ALPHA(node_id, prop, idx, id) \
+	_PARAM_SCALE(id) - _GET_CH_PARAM_AS_ALPHA(id, idx),
+
 #define _NUM_VALUES(id)	\
 	DT_INST_PROP_LEN(id, values)
 
 #define _VALUE_SPEC(node_id, prop, idx)	\
 	VALUE_DT_SPEC_GET_BY_IDX(node_id, prop, idx),
 
+#define _FILTER_TYPE(id) \
+	DT_INST_STRING_TOKEN(id, filter_type)
+
+#define _WINDOW_LENGTH(id) \
+	DT_INST_PROP(id, window_length)
+
+/* state of filter channels */
+#define _FILTER_STATE_ema(id)
+
+#define _FILTER_STATE_moving_average(id)				  \
+	BUILD_ASSERT(DT_INST_NODE_HAS_PROP(id, window_length),		  \
+		     "Moving average filter requires window-length");	  \
+	BUILD_ASSERT(_WINDOW_LENGTH(id) >= 1 &&				  \
+		     _WINDOW_LENGTH(id) <= UINT16_MAX,			  \
+		     "Filter window-length should be in range 1..65535"); \
+	static struct filter_window filter_windows_##id[_NUM_VALUES(id)]; \
+	static value_t filter_ring_##id[_NUM_VALUES(id) * _WINDOW_LENGTH(id)];
+
+#define _FILTER_STATE_median(id)					       \
+	BUILD_ASSERT(DT_INST_NODE_HAS_PROP(id, window_length),		       \
+		     "Median filter requires window-length");		       \
+	BUILD_ASSERT(_WINDOW_LENGTH(id) >= 1 &&				       \
+		     _WINDOW_LENGTH(id) <= FILTER_MEDIAN_MAX_WINDOW,	       \
+		     "Median filter window-length should be in range 1..64");  \
+	static struct filter_window filter_windows_##id[_NUM_VALUES(id)];      \
+	static value_t filter_ring_##id[_NUM_VALUES(id) * _WINDOW_LENGTH(id)]; \
+	static value_t filter_sorted_##id[_NUM_VALUES(id) * _WINDOW_LENGTH(id)];
+
+#define _FILTER_STATE_biquad(id)					      \
+	BUILD_ASSERT(DT_INST_PROP_LEN_OR(id, biquad, 0) == 5,		      \
+		     "Biquad filter requires coefficients <b0 b1 b2 a1 a2>"); \
+	static struct filter_biquad filter_biquads_##id[_NUM_VALUES(id)];     \
+	static const value_t filter_coefs_##id[] = DT_INST_PROP(id, biquad);
+
+/* filter channel sample by kernel */
+#define _FILTER_KERNEL_moving_average(id)				   \
+	filter_moving_average(&filter_windows_##id[idx],		   \
+			      &filter_ring_##id[idx * _WINDOW_LENGTH(id)], \
+			      _WINDOW_LENGTH(id), value, ready)
+
+#define _FILTER_KERNEL_median(id)				     \
+	filter_median(&filter_windows_##id[idx],		     \
+		      &filter_ring_##id[idx * _WINDOW_LENGTH(id)],   \
+		      &filter_sorted_##id[idx * _WINDOW_LENGTH(id)], \
+		      _WINDOW_LENGTH(id), value, ready)
+
+#define _FILTER_KERNEL_biquad(id)				    \
+	filter_biquad(&filter_biquads_##id[idx], filter_coefs_##id, \
+		      _PARAM_SCALE(id), value, ready)
+
+#define _HAS_ADAPTIVE(id) \
+	DT_INST_NODE_HAS_PROP(id, adaptive_samples)
+
+#define _ADAPTIVE_SAMPLES(id) \
+	DT_INST_PROP_OR(id, adaptive_samples, 0)
+
+#define _ADAPTIVE_BAND(id)					\
+	COND_CODE_1(DT_INST_NODE_HAS_PROP(id, adaptive_band),	\
+		    (FIXP_DT_INST_PROP_SCALE(id, adaptive_band,	\
+					     output_scale)), (0))
+
+#define _FILTER_ADAPTIVE_DEFINE(id)					\
+	BUILD_ASSERT(!_HAS_ADAPTIVE(id) ||				\
+		     DT_INST_ENUM_IDX(id, filter_type) == 0,		\
+		     "Adaptive alpha is supported by EMA filter only");	\
+	BUILD_ASSERT(_ADAPTIVE_SAMPLES(id) <= UINT16_MAX,		\
+		     "Too many adaptive samples");			\
+	IF_ENABLED(_HAS_ADAPTIVE(id),					\
+		   (static uint16_t filter_boosts_##id[_NUM_VALUES(id)];))
+
+#define _OUTLIER_WINDOW(id) \
+	DT_INST_PROP(id, outlier_window)
+
+/* threshold in MADs scaled to estimate standard deviation (k * 1.4826) */
+#define _OUTLIER_THRESHOLD(id)					     \
+	(COND_CODE_1(DT_INST_NODE_HAS_PROP(id, outlier_threshold),   \
+		     (FIXP_DT_INST_PROP_SCALE(id, outlier_threshold, \
+					      param_scale)),	     \
+		     (3 * (int64_t)_PARAM_SCALE(id))) * 14826 / 10000)
+
+/* deviation from median which is never rejected (in units of input) */
+#define _OUTLIER_MIN_DEVIATION(id)					\
+	COND_CODE_1(DT_INST_NODE_HAS_PROP(id, outlier_min_deviation),	\
+		    (FIXP_DT_INST_PROP_SCALE(id, outlier_min_deviation,	\
+					     input_scale)),		\
+		    (0))
+
+#define _OUTLIER_RATE(id) \
+	FIXP_DT_INST_PROP_SCALE(id, outlier_rate, input_scale)
+
+#define _HAS_OUTLIER_WINDOW(id)	\
+	DT_INST_NODE_HAS_PROP(id, outlier_window)
+
+#define _HAS_OUTLIER_RATE(id) \
+	DT_INST_NODE_HAS_PROP(id, outlier_rate)
+
+#define _HAS_OUTLIER(id) \
+	UTIL_OR(_HAS_OUTLIER_WINDOW(id), _HAS_OUTLIER_RATE(id))
+
+/* outlier rejection of all values of instance */
+#define _FILTER_REJECT_hampel(id)						  \
+	BUILD_ASSERT(_OUTLIER_WINDOW(id) >= 3 &&				  \
+		     _OUTLIER_WINDOW(id) <= 15 &&				  \
+		     _OUTLIER_WINDOW(id) % 2 == 1,				  \
+		     "Filter outlier-window should be odd in range 3..15");	  \
+	static struct filter_window filter_outlier_windows_##id[_NUM_VALUES(id)]; \
+	static value_t filter_outlier_rings_##id[_NUM_VALUES(id) *		  \
+						 _OUTLIER_WINDOW(id)];		  \
+										  \
+	static unsigned filter_reject_##id(const struct device *dev,		  \
+					   value_t *inputs,			  \
+					   const uint32_t *ok)			  \
+	{									  \
+		return filter_hampel_pass(dev, inputs, ok,			  \
+					  filter_outlier_windows_##id,		  \
+					  filter_outlier_rings_##id,		  \
+					  _OUTLIER_WINDOW(id),			  \
+					  _OUTLIER_THRESHOLD(id),		  \
+					  _OUTLIER_MIN_DEVIATION(id),		  \
+					  _PARAM_SCALE(id));			  \
+	}
+
+#define _FILTER_REJECT_rate(id)					     \
+	BUILD_ASSERT(_OUTLIER_RATE(id) > 0,			     \
+		     "Filter outlier-rate should be positive");	     \
+	static value_t filter_outlier_lasts_##id[_NUM_VALUES(id)];   \
+								     \
+	static unsigned filter_reject_##id(const struct device *dev, \
+					   value_t *inputs,	     \
+					   const uint32_t *ok)	     \
+	{							     \
+		return filter_rate_pass(dev, inputs, ok,	     \
+					filter_outlier_lasts_##id,   \
+					_OUTLIER_RATE(id));	     \
+	}
+
+#define _FILTER_OUTLIER_DEFINE(id)					     \
+	BUILD_ASSERT(!(_HAS_OUTLIER_WINDOW(id) && _HAS_OUTLIER_RATE(id)),    \
+		     "Either outlier-window or outlier-rate should be set"); \
+	COND_CODE_1(_HAS_OUTLIER_WINDOW(id), (_FILTER_REJECT_hampel(id)),    \
+		    (IF_ENABLED(_HAS_OUTLIER_RATE(id),			     \
+				(_FILTER_REJECT_rate(id)))))
+
+/* filter of all values of instance */
+#define _FILTER_CALC_ema(id)						    \
+	static void filter_calc_##id(const struct device *dev,		    \
+				     const value_t *inputs,		    \
+				     const uint32_t *ok)		    \
+	{								    \
+		filter_ema_pass(dev, inputs, ok, _INPUT_SCALE(id),	    \
+				_OUTPUT_SCALE(id), _PARAM_SCALE(id),	    \
+				_ADAPTIVE_BAND(id), _ADAPTIVE_SAMPLES(id)); \
+	}
+
+#define _FILTER_CALC_KERNEL(id, kernel)					   \
+	static value_t filter_kernel_##id(unsigned idx, value_t value,	   \
+					  bool ready)			   \
+	{								   \
+		return kernel(id);					   \
+	}								   \
+									   \
+	static void filter_calc_##id(const struct device *dev,		   \
+				     const value_t *inputs,		   \
+				     const uint32_t *ok)		   \
+	{								   \
+		filter_kernel_pass(dev, inputs, ok, _INPUT_SCALE(id),	   \
+				   _OUTPUT_SCALE(id), filter_kernel_##id); \
+	}
+
+#define _FILTER_CALC_moving_average(id)	\
+	_FILTER_CALC_KERNEL(id, _FILTER_KERNEL_moving_average)
+
+#define _FILTER_CALC_median(id)	\
+	_FILTER_CALC_KERNEL(id, _FILTER_KERNEL_median)
+
+#define _FILTER_CALC_biquad(id)	\
+	_FILTER_CALC_KERNEL(id, _FILTER_KERNEL_biquad)
+
+#define _HAS_DECIMATION(id) \
+	DT_INST_NODE_HAS_PROP(id, decimation)
+
+#define _FILTER_DECIMATION_DEFINE(id)					   \
+	BUILD_ASSERT(DT_INST_PROP_OR(id, decimation, 1) >= 1,		   \
+		     "Filter decimation should be positive");		   \
+	BUILD_ASSERT(!DT_INST_PROP(id, decimation_average) ||		   \
+		     _HAS_DECIMATION(id),				   \
+		     "Filter decimation-average requires decimation");	   \
+	IF_ENABLED(_HAS_DECIMATION(id),					   \
+		   (static value_t filter_outputs_##id[_NUM_VALUES(id)];)) \
+	IF_ENABLED(DT_INST_PROP(id, decimation_average),		   \
+		   (static int64_t filter_sums_##id[_NUM_VALUES(id)];	   \
+		    static uint16_t filter_counts_##id[_NUM_VALUES(id)];))
+
+#define _FILTER_DECIMATION_CONFIG(id)				  \
+	IF_ENABLED(_HAS_DECIMATION(id),				  \
+		   (.outputs = filter_outputs_##id,		  \
+		    .decimation = DT_INST_PROP(id, decimation),)) \
+	IF_ENABLED(DT_INST_PROP(id, decimation_average),	  \
+		   (.sums = filter_sums_##id,			  \
+		    .counts = filter_counts_##id,))
+
 #define FILTER_DEVICE(id)						      \
 	FILTER_SETTINGS_HANDLER_DEFINE(id);				      \
 									      \
-	static value_t filter_calc_##id(const struct filter_param *param,     \
-					value_t value, value_t prev_value,    \
-					bool ready) {			      \
-		int64_t value_scaled = (int64_t)value *			      \
-				       DT_INST_PROP_OR(id, output_scale, 1) / \
-				       DT_INST_PROP_OR(id, input_scale, 1);   \
+	FILTER_WARM_DEFINE(id)						      \
+									      \
+	UTIL_CAT(_FILTER_STATE_, _FILTER_TYPE(id))(id)			      \
+									      \
+	UTIL_CAT(_FILTER_CALC_, _FILTER_TYPE(id))(id)			      \
+									      \
+	_CHECK_CH_PARAM(id, alpha);					      \
+	_CHECK_CH_PARAM(id, samples);					      \
+	_CHECK_CH_PARAM(id, window);					      \
+									      \
+	static value_t filter_alphas_##id[] = {				      \
+		DT_INST_FOREACH_PROP_ELEM_VARGS(id, values,		      \
+						_DEFAULT_ALPHA, id)	      \
+	};								      \
+									      \
+	static value_t filter_one_minus_alphas_##id[] = {		      \
+		DT_INST_FOREACH_PROP_ELEM_VARGS(id, values,		      \
+						_DEFAULT_ONE_MINUS_ALPHA, id) \
+	};								      \
+									      \
+	static const value_t filter_default_alphas_##id[] = {		      \
+		DT_INST_FOREACH_PROP_ELEM_VARGS(id, values,		      \
+						_DEFAULT_ALPHA, id)	      \
+	};								      \
+									      \
+	_FILTER_DECIMATION_DEFINE(id)					      \
+									      \
+	_FILTER_ADAPTIVE_DEFINE(id)					      \
 									      \
-		return ready ?						      \
-		       (value_scaled * (int64_t)param->alpha +		      \
-			(int64_t)prev_value *				      \
-			(int64_t)param->one_minus_alpha) /		      \
-		       _PARAM_SCALE(id) :				      \
-		       value_scaled;					      \
-	}								      \
+	_FILTER_OUTLIER_DEFINE(id)					      \
 									      \
 	static FILTER_DATA_STRUCT(, _NUM_VALUES(id))			      \
 	filter_data_##id = {						      \
-		.param = _SET_PARAM_ALPHA(id, _GET_PARAM_AS_ALPHA(id)),	      \
 		.active = DT_INST_PROP(id, initial_active),		      \
 	};								      \
 									      \
 	static const FILTER_CONFIG_STRUCT(, _NUM_VALUES(id))		      \
 	filter_config_##id = {						      \
 		FILTER_SETTINGS_CONFIG_FIELDS_INIT(id)			      \
+		FILTER_WARM_CONFIG_FIELDS_INIT(id)			      \
 		.num_values = _NUM_VALUES(id),				      \
 		.param_scale = _PARAM_SCALE(id),			      \
 		.calculate = filter_calc_##id,				      \
-		.default_alpha = _GET_PARAM_AS_ALPHA(id),		      \
+		IF_ENABLED(_HAS_OUTLIER(id),				      \
+			   (.reject = filter_reject_##id,))		      \
+		.alphas = filter_alphas_##id,				      \
+		.one_minus_alphas = filter_one_minus_alphas_##id,	      \
+		.default_alphas = filter_default_alphas_##id,		      \
 		.period = _CALC_PERIOD(id),				      \
+		_FILTER_DECIMATION_CONFIG(id)				      \
+		IF_ENABLED(_HAS_ADAPTIVE(id),				      \
+			   (.boosts = filter_boosts_##id,))		      \
 		.values = {						      \
 			DT_INST_FOREACH_PROP_ELEM(id, values, _VALUE_SPEC)    \
 		},							      \
@@ -115,6 +115,9 @@ static int cmd_list(const struct shell *shell, size_t argc, char **argv)
 			io->print_param(shell, value);
 		}
 
+		value_get(dev, FILTER_REJECTED, &value);
+		shell_fprintf(shell, SHELL_NORMAL, ", rejected=%u", (unsigned)value);
+
 		shell_print(shell, ")");
 	}
 	return 0;
@@ -52,14 +52,19 @@ static void minmax_task(const struct device *dev)
 	const struct minmax_config *cfg = dev->config;
 	struct minmax_data *data = dev->data;
 	struct minmax_entry *entry;
+	value_t values[cfg->num_values];
+	int rcs[cfg->num_values];
 	value_t value;
 	unsigned ch;
 
+	value_get_many_dt(cfg->values, values, rcs, cfg->num_values);
+
 	for (ch = 0; ch < cfg->num_values; ch++) {
-		if (value_get_dt(&cfg->values[ch], &value)) {
+		if (rcs[ch] != 0) {
 			continue;
 		}
 
+		value = values[ch];
 		entry = &data->entries[ch];
 
 		if (is_flag(data->ready, ch)) {
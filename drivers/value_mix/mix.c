@@ -62,18 +62,14 @@ LOG_MODULE_REGISTER(mix, CONFIG_VALUE_MIX_LOG_LEVEL);
 
 MIX_DATA_STRUCT(mix_data, 0);
 
-struct mix_input {
-	struct value_dt_spec value_spec;
-	value_t default_weight;
-};
-
 #define MIX_CONFIG_STRUCT(type_name, num_values_)		      \
 	struct type_name {					      \
 		MIX_SETTINGS_CONFIG_FIELDS			      \
-		int (*calc)(const struct mix_input *inputs,	      \
+		int (*calc)(const struct value_dt_spec *inputs,	      \
 			    const value_t *weights, value_t *output); \
+		const value_t *default_weights;			      \
 		unsigned num_inputs;				      \
-		struct mix_input inputs[num_values_];		      \
+		struct value_dt_spec inputs[num_values_];	      \
 	}
 
 MIX_CONFIG_STRUCT(mix_config, 0);
@@ -143,7 +139,7 @@ static inline void mix_weights_reset(const struct device *dev)
 	unsigned idx;
 
 	for (idx = 0; idx < cfg->num_inputs; idx++) {
-		data->weights[idx] = cfg->inputs[idx].default_weight;
+		data->weights[idx] = cfg->default_weights[idx];
 	}
 }
 
@@ -278,11 +274,8 @@ static int mix_init(const struct device *dev)
 		   (double)DT_PROP(node_id, weight_divider),		    \
 		   _MIX_WEIGHT_SCALE(node_id)),
 
-#define _MIX_INPUT(node_id, prop, idx)					    \
-	{								    \
-		.value_spec = VALUE_DT_SPEC_GET_BY_IDX(node_id, prop, idx), \
-		.default_weight = _MIX_WEIGHT(node_id, prop, idx)	    \
-	},
+#define _MIX_INPUT(node_id, prop, idx) \
+	VALUE_DT_SPEC_GET_BY_IDX(node_id, prop, idx),
 
 #define _MIX_INPUT_SCALE(node_id, idx)				  \
 	COND_CODE_1(DT_PROP_HAS_IDX(node_id, input_scales, idx),  \
@@ -296,14 +289,8 @@ static int mix_init(const struct device *dev)
 	DT_PROP(node_id, output_scale)
 
 #define _MIX_CALC_VALUE(node_id, prop, idx)			\
-	rc = value_get_dt(&inputs[idx].value_spec, &val);	\
-								\
-	if (rc != 0) {						\
-		goto end;					\
-	}							\
-								\
 	if (weights[idx] != 0) {				\
-		res += FIXP_MUL(val, weights[idx],		\
+		res += FIXP_MUL(vals[idx], weights[idx],	\
 				_MIX_INPUT_SCALE(node_id, idx),	\
 				_MIX_WEIGHT_SCALE(node_id),	\
 				_MIX_OUTPUT_SCALE(node_id));	\
@@ -316,22 +303,32 @@ static int mix_init(const struct device *dev)
 								    \
 	MIX_SETTINGS_HANDLER_DEFINE(id);			    \
 								    \
-	static int mix_calc_##id(const struct mix_input *inputs,    \
+	static int mix_calc_##id(const struct value_dt_spec *specs, \
 				 const value_t *weights,	    \
 				 value_t *output)		    \
 	{							    \
-		value_t val;					    \
+		value_t vals[_MIX_VALUES(id)];			    \
+		int rcs[_MIX_VALUES(id)];			    \
 		value_t res = 0;				    \
 		int rc;						    \
 								    \
+		rc = value_get_many_dt(specs, vals, rcs,	    \
+				       _MIX_VALUES(id));	    \
+		if (rc != 0) {					    \
+			return rc;				    \
+		}						    \
+								    \
 		DT_INST_FOREACH_PROP_ELEM(id, values,		    \
 					  _MIX_CALC_VALUE);	    \
 								    \
 		*output = res;					    \
-end:								    \
-		return rc;					    \
+		return 0;					    \
 	}							    \
 								    \
+	static const value_t mix_default_weights_##id[] = {	    \
+		DT_INST_FOREACH_PROP_ELEM(id, values, _MIX_WEIGHT)  \
+	};							    \
+								    \
 	static MIX_DATA_STRUCT(, _MIX_VALUES(id)) mix_data_##id = { \
 		.active = DT_INST_PROP(id, initial_active),	    \
 	};							    \
@@ -340,6 +337,7 @@ end:								    \
 	mix_config_##id = {					    \
 		.num_inputs = DT_INST_PROP_LEN(id, values),	    \
 		.calc = mix_calc_##id,				    \
+		.default_weights = mix_default_weights_##id,	    \
 		.inputs = {					    \
 			DT_INST_FOREACH_PROP_ELEM(id, values,	    \
 						  _MIX_INPUT)	    \
@@ -267,9 +267,49 @@ static int params_value_set(const struct device *dev, value_id_t id, value_t val
 	return rc;
 }
 
+static int params_value_get_many(const struct device *dev, const value_id_t *ids,
+				 value_t *pvals, int *rcs, size_t num)
+{
+	size_t idx;
+	int rc = 0;
+
+	for (idx = 0; idx < num; idx++) {
+		/* parameters is got directly, the other values as usual */
+		rcs[idx] = ids[idx] < PARAMS_NUMBER_ALL ?
+			   param_get(dev, ids[idx], &pvals[idx]) :
+			   params_value_get(dev, ids[idx], &pvals[idx]);
+		if (rcs[idx] != 0 && rc == 0) {
+			rc = rcs[idx];
+		}
+	}
+
+	return rc;
+}
+
+static int params_value_set_many(const struct device *dev, const value_id_t *ids,
+				 const value_t *vals, int *rcs, size_t num)
+{
+	size_t idx;
+	int rc = 0;
+
+	for (idx = 0; idx < num; idx++) {
+		/* parameters is set directly, the other values as usual */
+		rcs[idx] = ids[idx] < PARAMS_NUMBER_ALL ?
+			   param_set(dev, ids[idx], vals[idx]) :
+			   params_value_set(dev, ids[idx], vals[idx]);
+		if (rcs[idx] != 0 && rc == 0) {
+			rc = rcs[idx];
+		}
+	}
+
+	return rc;
+}
+
 static const struct value_driver_api params_api = {
 	.get = params_value_get,
 	.set = params_value_set,
+	.get_many = params_value_get_many,
+	.set_many = params_value_set_many,
 };
 
 static int params_init(const struct device *dev)
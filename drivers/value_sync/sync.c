@@ -6,74 +6,577 @@
 
 #include <zephyr/dt-bindings/value/sync.h>
 #include <zephyr/drivers/value.h>
+#include <zephyr/drivers/value_workq.h>
 #include <zephyr/kernel.h>
 #include <zephyr/device.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/kernel.h>
+#include <string.h>
 
 #if IS_ENABLED(CONFIG_VALUE_SYNC_TIMING)
 #include <timing/timing.h>
 #endif /* IS_ENABLED(CONFIG_VALUE_SYNC_TIMING) */
 
+#if IS_ENABLED(CONFIG_VALUE_SYNC_COUNTER)
+#include <zephyr/drivers/counter.h>
+#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_COUNTER) */
+
+#if IS_ENABLED(CONFIG_VALUE_SYNC_SCHEDULE)
+/* generated at build time using sync_sched.py */
+#include <value_sync_sched.h>
+#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_SCHEDULE) */
+
 #define DT_DRV_COMPAT SYNC_DT_COMPAT
 
 LOG_MODULE_REGISTER(sync, CONFIG_VALUE_SYNC_LOG_LEVEL);
 
+enum sync_overrun {
+	/* drop missed cycles */
+	SYNC_OVERRUN_SKIP,
+	/* run missed cycles one by one */
+	SYNC_OVERRUN_CATCH_UP,
+	/* run missed cycles as a single cycle */
+	SYNC_OVERRUN_COALESCE,
+};
+
 struct sync_data {
 	/* control loop work */
 	struct k_work_delayable work;
 	/* pointer to device (needed for delayable work) */
 	const struct device *dev;
+	/* start time of control loop (in ticks) */
+	int64_t start;
+	/* number of current control loop cycle */
+	uint64_t cycle;
+	/* number of the first cycle which is not run (or skipped) yet */
+	uint64_t next_run;
+	/* number of missed deadlines */
+	uint32_t missed;
+	/* total number of ticks after deadlines */
+	uint32_t late_ticks;
+#if IS_ENABLED(CONFIG_VALUE_SYNC_COUNTER)
+	/* control loop work triggered by counter */
+	struct k_work trigger;
+	/* counter is running */
+	bool counting;
+#if IS_ENABLED(CONFIG_VALUE_SYNC_TIMING)
+	/* time of last counter interrupt */
+	timing_t trigger_time;
+#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_TIMING) */
+#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_COUNTER) */
 #if IS_ENABLED(CONFIG_VALUE_SYNC_TIMING)
 	uint32_t min_cycles;
 	uint32_t max_cycles;
+	/* wake-up jitter (in microseconds) */
+	uint32_t min_jitter;
+	uint32_t max_jitter;
+	/* log2-scale histogram of cycles */
+	uint32_t hist[CONFIG_VALUE_SYNC_TIMING_HIST_BINS];
 #endif
 };
 
-struct sync_config {
-	/* sync values */
+#if IS_ENABLED(CONFIG_VALUE_SYNC_TIMING)
+struct sync_target_stats {
+	/* total cycles spent to synchronize value */
+	uint64_t total_cycles;
+	uint32_t max_cycles;
+};
+#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_TIMING) */
+
+struct sync_group {
+	/* group values */
 	const struct value_dt_spec *values;
-	uint32_t sync_period;
+#if IS_ENABLED(CONFIG_VALUE_SYNC_TIMING)
+	/* timing of each value */
+	struct sync_target_stats *stats;
+#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_TIMING) */
+	/* group runs each divider-th cycle */
+	uint16_t divider;
+	/* cycle offset of group within divider */
+	uint16_t phase;
 	uint8_t num_values;
+};
+
+struct sync_config {
+	/* sync groups */
+	const struct sync_group *groups;
+	/* dedicated work queue (NULL to use value work queue) */
+	struct k_work_q *queue;
+	k_thread_stack_t *queue_stack;
+	size_t queue_stack_size;
+	int queue_priority;
+	int queue_cpu;
+#if IS_ENABLED(CONFIG_VALUE_SYNC_COUNTER)
+	/* counter to trigger control loop (NULL to use kernel timeouts) */
+	const struct device *counter;
+	/* period of counter in microseconds */
+	uint32_t counter_period;
+	/* run control loop directly in counter interrupt */
+	bool counter_isr;
+#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_COUNTER) */
+	uint32_t sync_period;
+	uint8_t num_groups;
+	uint8_t overrun;
 	bool initial_active;
 };
 
+/* get deadline of control loop cycle (in ticks) */
+static inline int64_t sync_deadline(const struct device *dev, uint64_t cycle)
+{
+	const struct sync_config *cfg = dev->config;
+	struct sync_data *data = dev->data;
+
+	return data->start + k_ms_to_ticks_ceil64(cycle * cfg->sync_period);
+}
+
+/* get the last control loop cycle which deadline is reached at time (in ticks) */
+static inline uint64_t sync_cycle_at(const struct device *dev, int64_t ticks)
+{
+	const struct sync_config *cfg = dev->config;
+	struct sync_data *data = dev->data;
+
+	return k_ticks_to_ms_floor64(ticks - data->start) / cfg->sync_period;
+}
+
+/* get work queue to run control loop */
+static inline struct k_work_q *sync_queue(const struct device *dev)
+{
+	const struct sync_config *cfg = dev->config;
+
+	return cfg->queue != NULL ? cfg->queue : VALUE_WORKQ;
+}
+
+/* schedule control loop cycle */
+static inline int sync_schedule(const struct device *dev)
+{
+	struct sync_data *data = dev->data;
+
+	return k_work_schedule_for_queue(sync_queue(dev), &data->work,
+					 K_TIMEOUT_ABS_TICKS(sync_deadline(dev, data->cycle)));
+}
+
+static int sync_start(const struct device *dev)
+{
+	struct sync_data *data = dev->data;
+
+	data->start = k_uptime_ticks();
+	data->cycle = 1;
+	data->next_run = 0;
+
+	return sync_schedule(dev);
+}
+
+/*
+ * Synchronize values of groups which should run in cycles from first to
+ * last, so the group which cycle is skipped on overrun runs with the last
+ * cycle instead of waiting for the next period of group.
+ */
+static void sync_run(const struct device *dev, uint64_t first, uint64_t last,
+		     uint32_t period)
+{
+	const struct sync_config *cfg = dev->config;
+	const struct sync_group *group = &cfg->groups[0];
+	const struct sync_group *group_end = &cfg->groups[cfg->num_groups];
+	size_t idx;
+
+#if IS_ENABLED(CONFIG_VALUE_SYNC_TIMING)
+	struct sync_target_stats *stats;
+	timing_t start_time;
+	timing_t end_time;
+	uint64_t cycles;
+#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_TIMING) */
+
+	for (; group < group_end; group++) {
+		/* the first cycle of group since first */
+		if (first + (group->divider + group->phase - first % group->divider) %
+		    group->divider > last) {
+			continue;
+		}
+
+		for (idx = 0; idx < group->num_values; idx++) {
+#if IS_ENABLED(CONFIG_VALUE_SYNC_TIMING)
+			start_time = timing_counter_get();
+#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_TIMING) */
+
+			value_set_dt(&group->values[idx], period * group->divider);
+
+#if IS_ENABLED(CONFIG_VALUE_SYNC_TIMING)
+			end_time = timing_counter_get();
+			cycles = timing_cycles_get(&start_time, &end_time);
+
+			stats = &group->stats[idx];
+			stats->total_cycles += cycles;
+			if (cycles > stats->max_cycles) {
+				stats->max_cycles = cycles;
+			}
+#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_TIMING) */
+		}
+	}
+}
+
+#if IS_ENABLED(CONFIG_VALUE_SYNC_TIMING)
+/* get histogram bin of cycles: bin n counts cycles in [2^n, 2^(n+1)) */
+static inline size_t sync_hist_bin(uint64_t cycles)
+{
+	size_t bin = 0;
+
+	while (cycles > 1 && bin < CONFIG_VALUE_SYNC_TIMING_HIST_BINS - 1) {
+		cycles >>= 1;
+		bin++;
+	}
+
+	return bin;
+}
+
+static void sync_timing_update(const struct device *dev, timing_t start_time,
+			       uint32_t jitter)
+{
+	struct sync_data *data = dev->data;
+	timing_t end_time = timing_counter_get();
+	uint64_t cycles = timing_cycles_get(&start_time, &end_time);
+
+	if (data->min_cycles == 0 || cycles < data->min_cycles) {
+		data->min_cycles = cycles;
+	}
+	if (data->max_cycles == 0 || cycles > data->max_cycles) {
+		data->max_cycles = cycles;
+	}
+
+	if (jitter < data->min_jitter) {
+		data->min_jitter = jitter;
+	}
+	if (jitter > data->max_jitter) {
+		data->max_jitter = jitter;
+	}
+
+	data->hist[sync_hist_bin(cycles)]++;
+}
+#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_TIMING) */
+
+/* reset synchronization statistics */
+static void sync_stats_reset(const struct device *dev)
+{
+	struct sync_data *data = dev->data;
+
+#if IS_ENABLED(CONFIG_VALUE_SYNC_TIMING)
+	const struct sync_config *cfg = dev->config;
+	const struct sync_group *group = &cfg->groups[0];
+	const struct sync_group *group_end = &cfg->groups[cfg->num_groups];
+
+	for (; group < group_end; group++) {
+		memset(group->stats, 0, group->num_values * sizeof(*group->stats));
+	}
+
+	data->min_cycles = 0;
+	data->max_cycles = 0;
+	data->min_jitter = UINT32_MAX;
+	data->max_jitter = 0;
+	memset(data->hist, 0, sizeof(data->hist));
+#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_TIMING) */
+
+	data->missed = 0;
+	data->late_ticks = 0;
+}
+
+#if IS_ENABLED(CONFIG_VALUE_SYNC_TIMING)
+/* get timing of synchronized value by index (in order of synchronization) */
+static struct sync_target_stats *sync_target_stats(const struct device *dev, size_t idx)
+{
+	const struct sync_config *cfg = dev->config;
+	const struct sync_group *group = &cfg->groups[0];
+	const struct sync_group *group_end = &cfg->groups[cfg->num_groups];
+
+	for (; group < group_end; group++) {
+		if (idx < group->num_values) {
+			return &group->stats[idx];
+		}
+		idx -= group->num_values;
+	}
+
+	return NULL;
+}
+#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_TIMING) */
+
+static void sync_work(struct k_work *work)
+{
+	struct k_work_delayable *kwd = k_work_delayable_from_work(work);
+	struct sync_data *data = CONTAINER_OF(kwd, struct sync_data, work);
+	const struct device *dev = data->dev;
+	const struct sync_config *cfg = dev->config;
+	int64_t now = k_uptime_ticks();
+	int64_t late = now - sync_deadline(dev, data->cycle);
+	/* number of cycle to run (the first cycle is zero) */
+	uint64_t cycle = data->cycle - 1;
+	uint64_t last;
+
+#if IS_ENABLED(CONFIG_VALUE_SYNC_TIMING)
+	timing_t start_time;
+#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_TIMING) */
+
+	if (late > 0) {
+		data->late_ticks += late;
+	}
+
+	data->cycle++;
+
+	/* check for overrun */
+	last = sync_cycle_at(dev, now);
+	if (last >= data->cycle) {
+		switch (cfg->overrun) {
+		case SYNC_OVERRUN_SKIP:
+			data->missed += last - data->cycle + 1;
+			data->cycle = last + 1;
+			break;
+		case SYNC_OVERRUN_COALESCE:
+			data->missed += last - data->cycle;
+			data->cycle = last;
+			break;
+		default:
+			/* the missed cycles will be run immediately,
+			 * count each one which runs after the next deadline
+			 */
+			data->missed++;
+			break;
+		}
+	}
+
+	if (!(k_work_delayable_busy_get(&data->work) & K_WORK_CANCELING)) {
+		/* re-schedule control loop work when active */
+		sync_schedule(dev);
+	}
+
+#if IS_ENABLED(CONFIG_VALUE_SYNC_TIMING)
+	start_time = timing_counter_get();
+#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_TIMING) */
+
+	sync_run(dev, data->next_run, cycle, cfg->sync_period);
+	data->next_run = cycle + 1;
+
+#if IS_ENABLED(CONFIG_VALUE_SYNC_TIMING)
+	/* delay from deadline to start of cycle */
+	sync_timing_update(dev, start_time,
+			   late > 0 ? (uint32_t)k_ticks_to_us_floor64(late) : 0);
+#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_TIMING) */
+}
+
+#if IS_ENABLED(CONFIG_VALUE_SYNC_COUNTER)
+
+/* check that control loop is triggered by counter */
+static inline bool sync_has_counter(const struct device *dev)
+{
+	const struct sync_config *cfg = dev->config;
+
+	return cfg->counter != NULL;
+}
+
+/* run control loop cycle triggered by counter */
+static void sync_counter_cycle(const struct device *dev)
+{
+	const struct sync_config *cfg = dev->config;
+	struct sync_data *data = dev->data;
+
+#if IS_ENABLED(CONFIG_VALUE_SYNC_TIMING)
+	timing_t start_time = timing_counter_get();
+	/* delay from counter interrupt to start of cycle */
+	uint32_t jitter = timing_cycles_to_ns(timing_cycles_get(&data->trigger_time,
+								 &start_time)) / 1000;
+#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_TIMING) */
+
+	sync_run(dev, data->cycle, data->cycle, cfg->counter_period);
+	data->cycle++;
+
+#if IS_ENABLED(CONFIG_VALUE_SYNC_TIMING)
+	/* measure latency from counter interrupt to completion */
+	sync_timing_update(dev, data->trigger_time, jitter);
+#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_TIMING) */
+}
+
+static void sync_counter_work(struct k_work *work)
+{
+	struct sync_data *data = CONTAINER_OF(work, struct sync_data, trigger);
+
+	sync_counter_cycle(data->dev);
+}
+
+static void sync_counter_top(const struct device *counter, void *user_data)
+{
+	const struct device *dev = user_data;
+	const struct sync_config *cfg = dev->config;
+	struct sync_data *data = dev->data;
+
+#if IS_ENABLED(CONFIG_VALUE_SYNC_TIMING)
+	timing_t trigger_time = timing_counter_get();
+#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_TIMING) */
+
+	ARG_UNUSED(counter);
+
+	if (cfg->counter_isr) {
+#if IS_ENABLED(CONFIG_VALUE_SYNC_TIMING)
+		data->trigger_time = trigger_time;
+#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_TIMING) */
+		sync_counter_cycle(dev);
+		return;
+	}
+
+	if (k_work_is_pending(&data->trigger)) {
+		/* previous cycle still waits to run */
+		data->missed++;
+		return;
+	}
+
+#if IS_ENABLED(CONFIG_VALUE_SYNC_TIMING)
+	data->trigger_time = trigger_time;
+#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_TIMING) */
+
+	k_work_submit_to_queue(sync_queue(dev), &data->trigger);
+}
+
+static int sync_counter_start(const struct device *dev)
+{
+	const struct sync_config *cfg = dev->config;
+	struct sync_data *data = dev->data;
+	struct counter_top_cfg top_cfg = {
+		.ticks = counter_us_to_ticks(cfg->counter, cfg->counter_period),
+		.callback = sync_counter_top,
+		.user_data = (void *)dev,
+		.flags = 0,
+	};
+	int status;
+
+	data->cycle = 0;
+
+	status = counter_set_top_value(cfg->counter, &top_cfg);
+	if (status < 0) {
+		LOG_ERR("%s: Unable to set counter period: %d", dev->name, status);
+		return status;
+	}
+
+	status = counter_start(cfg->counter);
+	if (status < 0) {
+		LOG_ERR("%s: Unable to start counter: %d", dev->name, status);
+		return status;
+	}
+
+	data->counting = true;
+
+	return 0;
+}
+
+static int sync_counter_stop(const struct device *dev)
+{
+	const struct sync_config *cfg = dev->config;
+	struct sync_data *data = dev->data;
+	int status;
+
+	status = counter_stop(cfg->counter);
+	if (status < 0) {
+		return status;
+	}
+
+	data->counting = false;
+
+	k_work_cancel(&data->trigger);
+
+	return 0;
+}
+
+#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_COUNTER) */
+
 static bool sync_is_active(const struct device *dev)
 {
 	struct sync_data *data = dev->data;
 
+#if IS_ENABLED(CONFIG_VALUE_SYNC_COUNTER)
+	if (sync_has_counter(dev)) {
+		return data->counting;
+	}
+#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_COUNTER) */
+
 	return k_work_delayable_is_pending(&data->work);
 }
 
 static int sync_set_active(const struct device *dev, bool active)
 {
-	const struct sync_config *cfg = dev->config;
 	struct sync_data *data = dev->data;
 
 	if (active == sync_is_active(dev)) {
 		return 0;
 	}
 
+#if IS_ENABLED(CONFIG_VALUE_SYNC_COUNTER)
+	if (sync_has_counter(dev)) {
+		return active ?
+		       sync_counter_start(dev) :
+		       sync_counter_stop(dev);
+	}
+#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_COUNTER) */
+
 	return active ?
 	       /* start syncing loop */
-	       k_work_schedule(&data->work, K_MSEC(cfg->sync_period)) :
+	       sync_start(dev) :
 	       /* stop syncing loop */
 	       k_work_cancel_delayable(&data->work);
 }
 
-static int sync_value_get(const struct device *dev, value_id_t id, value_t *pval)
-{
 #if IS_ENABLED(CONFIG_VALUE_SYNC_TIMING)
+/* get value of histogram or synchronized value timing */
+static int sync_stats_get(const struct device *dev, value_id_t id, value_t *pval)
+{
 	struct sync_data *data = dev->data;
+	struct sync_target_stats *stats;
+	value_id_t idx = id & SYNC_INDEX_MASK;
+
+	switch (id & ~SYNC_INDEX_MASK) {
+	case SYNC_HIST(0):
+		if (idx >= CONFIG_VALUE_SYNC_TIMING_HIST_BINS) {
+			return -EINVAL;
+		}
+		*pval = data->hist[idx];
+		return 0;
+
+	case SYNC_TARGET_TOTAL(0):
+		stats = sync_target_stats(dev, idx);
+		if (stats == NULL) {
+			return -EINVAL;
+		}
+		/* in thousands of cycles */
+		*pval = MIN(stats->total_cycles / 1000, INT32_MAX);
+		return 0;
+
+	case SYNC_TARGET_MAX(0):
+		stats = sync_target_stats(dev, idx);
+		if (stats == NULL) {
+			return -EINVAL;
+		}
+		*pval = stats->max_cycles;
+		return 0;
+
+	default:
+		return -EINVAL;
+	}
+}
 #endif /* IS_ENABLED(CONFIG_VALUE_SYNC_TIMING) */
 
+static int sync_value_get(const struct device *dev, value_id_t id, value_t *pval)
+{
+	const struct sync_config *cfg = dev->config;
+	struct sync_data *data = dev->data;
 	int status = 0;
+	size_t idx;
 
 	switch (id) {
 	case SYNC_STATE:
 		*pval = sync_is_active(dev);
 		break;
 
+	case SYNC_MISSED:
+		*pval = data->missed;
+		break;
+
+	case SYNC_LATE_TICKS:
+		*pval = data->late_ticks;
+		break;
+
 #if IS_ENABLED(CONFIG_VALUE_SYNC_TIMING)
 	case SYNC_MIN_CYCLES:
 		*pval = data->min_cycles;
@@ -81,9 +584,28 @@ static int sync_value_get(const struct device *dev, value_id_t id, value_t *pval
 	case SYNC_MAX_CYCLES:
 		*pval = data->max_cycles;
 		break;
+	case SYNC_MIN_JITTER:
+		*pval = data->min_jitter != UINT32_MAX ? data->min_jitter : 0;
+		break;
+	case SYNC_MAX_JITTER:
+		*pval = data->max_jitter;
+		break;
 #endif /* IS_ENABLED(CONFIG_VALUE_SYNC_TIMING) */
 
+	case SYNC_NUM_TARGETS:
+		*pval = 0;
+		for (idx = 0; idx < cfg->num_groups; idx++) {
+			*pval += cfg->groups[idx].num_values;
+		}
+		break;
+
 	default:
+#if IS_ENABLED(CONFIG_VALUE_SYNC_TIMING)
+		status = sync_stats_get(dev, id, pval);
+		if (status == 0) {
+			break;
+		}
+#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_TIMING) */
 		LOG_ERR("%s: attempt to get unknown value #%d", dev->name, id);
 		status = -EINVAL;
 	}
@@ -103,6 +625,10 @@ static int sync_value_set(const struct device *dev, value_id_t id, value_t val)
 		}
 		break;
 
+	case SYNC_RESET:
+		sync_stats_reset(dev);
+		break;
+
 	default:
 		LOG_ERR("%s: attempt to set unknown value #%d", dev->name, id);
 		status = -EINVAL;
@@ -116,85 +642,184 @@ static const struct value_driver_api sync_api = {
 	.set = sync_value_set,
 };
 
-static void sync_work(struct k_work *work)
+static int sync_init(const struct device *dev)
 {
-	struct k_work_delayable *kwd = k_work_delayable_from_work(work);
-	struct sync_data *data = CONTAINER_OF(work, struct sync_data, work);
-	const struct device *dev = data->dev;
 	const struct sync_config *cfg = dev->config;
-	const struct value_dt_spec *value = &cfg->values[0];
-	const struct value_dt_spec *value_end = &cfg->values[cfg->num_values];
-
-#if IS_ENABLED(CONFIG_VALUE_SYNC_TIMING)
-	timing_t start_time;
-	timing_t end_time;
-	uint64_t cycles;
-#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_TIMING) */
-
-	if (!(k_work_delayable_busy_get(&data->work) & K_WORK_CANCELING)) {
-		/* re-schedule control loop work when active */
-		k_work_schedule(&data->work, K_MSEC(cfg->sync_period));
-	}
+	struct sync_data *data = dev->data;
+	int status = 0;
 
-#if IS_ENABLED(CONFIG_VALUE_SYNC_TIMING)
-	start_time = timing_counter_get();
-#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_TIMING) */
+	k_work_init_delayable(&data->work, sync_work);
 
-	for (; value < value_end; value++) {
-		value_set_dt(value, cfg->sync_period);
-	}
+	sync_stats_reset(dev);
 
-#if IS_ENABLED(CONFIG_VALUE_SYNC_TIMING)
-	end_time = timing_counter_get();
+#if IS_ENABLED(CONFIG_VALUE_SYNC_COUNTER)
+	k_work_init(&data->trigger, sync_counter_work);
 
-	cycles = timing_cycles_get(&start_time, &end_time);
+	if (sync_has_counter(dev)) {
+		if (!device_is_ready(cfg->counter)) {
+			LOG_ERR("%s: Counter device not ready", dev->name);
+			return -ENODEV;
+		}
 
-	if (data->min_cycles == 0 || cycles < data->min_cycles) {
-		data->min_cycles = cycles;
+		if (counter_us_to_ticks(cfg->counter, cfg->counter_period) == 0) {
+			LOG_ERR("%s: Counter period %uuS is too short",
+				dev->name, cfg->counter_period);
+			return -EINVAL;
+		}
 	}
-	if (data->max_cycles == 0 || cycles > data->max_cycles) {
-		data->max_cycles = cycles;
+#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_COUNTER) */
+
+	if (cfg->queue != NULL) {
+		status = value_workq_start(cfg->queue, cfg->queue_stack,
+					   cfg->queue_stack_size,
+					   cfg->queue_priority,
+					   cfg->queue_cpu, dev->name);
+		if (status < 0) {
+			LOG_WRN("%s: Unable to pin work queue to CPU%d: %d",
+				dev->name, cfg->queue_cpu, status);
+			status = 0;
+		}
 	}
-#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_TIMING) */
-}
-
-static int sync_init(const struct device *dev)
-{
-	const struct sync_config *cfg = dev->config;
-	struct sync_data *data = dev->data;
-	int status = 0;
-
-	k_work_init_delayable(&data->work, sync_work);
 
 	if (cfg->initial_active) {
-		status = k_work_schedule(&data->work, K_MSEC(cfg->sync_period));
+		status = sync_set_active(dev, true);
 	}
 
 	return status;
 }
 
+#if IS_ENABLED(CONFIG_VALUE_SYNC_SCHEDULE)
+
+#define SYNC_VALUE_DT_SPEC(idx, node_id) \
+	VALUE_DT_SPEC_GET_BY_IDX(node_id, values, idx),
+
+/* values in the order of dependencies */
+#define SYNC_VALUES(node_id)				    \
+	FOR_EACH_FIXED_ARG(SYNC_VALUE_DT_SPEC, (), node_id, \
+			   UTIL_CAT(VALUE_SYNC_SCHED_ORD_,  \
+				    DT_DEP_ORD(node_id)))
+
+#else /* !IS_ENABLED(CONFIG_VALUE_SYNC_SCHEDULE) */
+
 #define SYNC_VALUE_DT_SPEC(node_id, prop, idx) \
 	VALUE_DT_SPEC_GET_BY_IDX(node_id, prop, idx),
 
-#define SYNC_DEVICE(id)							  \
-									  \
-	static const struct value_dt_spec sync_values_##id[] = {	  \
-		DT_INST_FOREACH_PROP_ELEM(id, values, SYNC_VALUE_DT_SPEC) \
-	};								  \
-									  \
-	static struct sync_data sync_data_##id = {			  \
-		.dev = DEVICE_DT_GET(DT_DRV_INST(id)),			  \
-	};								  \
-									  \
-	static const struct sync_config sync_config_##id = {		  \
-		.values = sync_values_##id,				  \
-		.num_values = ARRAY_SIZE(sync_values_##id),		  \
-		.sync_period = DT_INST_PROP_OR(id, period, 1000),	  \
-		.initial_active = DT_INST_PROP(id, initial_active),	  \
-	};								  \
-									  \
-	DEVICE_DT_INST_DEFINE(id, sync_init, NULL, &sync_data_##id,	  \
-			      &sync_config_##id, POST_KERNEL,		  \
+/* values in the configured order */
+#define SYNC_VALUES(node_id) \
+	DT_FOREACH_PROP_ELEM(node_id, values, SYNC_VALUE_DT_SPEC)
+
+#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_SCHEDULE) */
+
+#define SYNC_GROUP_VALUES(node_id) \
+	UTIL_CAT(sync_values_, DT_DEP_ORD(node_id))
+
+#define SYNC_GROUP_STATS(node_id) \
+	UTIL_CAT(sync_stats_, DT_DEP_ORD(node_id))
+
+#define SYNC_GROUP_DEFINE(node_id)					   \
+	BUILD_ASSERT(DT_PROP_OR(node_id, phase, 0) <			   \
+		     DT_PROP_OR(node_id, divider, 1),			   \
+		     "sync group phase should be less than divider");	   \
+	static const struct value_dt_spec SYNC_GROUP_VALUES(node_id)[] = { \
+		SYNC_VALUES(node_id)					   \
+	};								   \
+	IF_ENABLED(CONFIG_VALUE_SYNC_TIMING,				   \
+		   (static struct sync_target_stats			   \
+		    SYNC_GROUP_STATS(node_id)[				   \
+			    ARRAY_SIZE(SYNC_GROUP_VALUES(node_id))];))
+
+#define SYNC_GROUP(node_id)					      \
+	{							      \
+		.values = SYNC_GROUP_VALUES(node_id),		      \
+		IF_ENABLED(CONFIG_VALUE_SYNC_TIMING,		      \
+			   (.stats = SYNC_GROUP_STATS(node_id),))     \
+		.divider = DT_PROP_OR(node_id, divider, 1),	      \
+		.phase = DT_PROP_OR(node_id, phase, 0),		      \
+		.num_values = ARRAY_SIZE(SYNC_GROUP_VALUES(node_id)), \
+	},
+
+/* top-level values are the first group (synchronized each cycle) */
+#define SYNC_INST_GROUPS(id, fn)		      \
+	IF_ENABLED(DT_INST_NODE_HAS_PROP(id, values), \
+		   (fn(DT_DRV_INST(id))))	      \
+	DT_INST_FOREACH_CHILD(id, fn)
+
+#define SYNC_HAS_QUEUE(id) \
+	DT_INST_NODE_HAS_PROP(id, work_queue_priority)
+
+#define SYNC_QUEUE_STACK_SIZE(id) \
+	DT_INST_PROP(id, work_queue_stack_size)
+
+#define SYNC_QUEUE_DEFINE(id)					      \
+	IF_ENABLED(SYNC_HAS_QUEUE(id),				      \
+		   (K_KERNEL_STACK_DEFINE(sync_queue_stack_##id,      \
+					  SYNC_QUEUE_STACK_SIZE(id)); \
+		    static struct k_work_q sync_queue_##id;))
+
+#define SYNC_QUEUE_CONFIG(id)						  \
+	IF_ENABLED(SYNC_HAS_QUEUE(id),					  \
+		   (.queue = &sync_queue_##id,				  \
+		    .queue_stack = sync_queue_stack_##id,		  \
+		    .queue_stack_size =					  \
+			    K_KERNEL_STACK_SIZEOF(sync_queue_stack_##id), \
+		    .queue_priority =					  \
+			    DT_INST_PROP(id, work_queue_priority),	  \
+		    .queue_cpu = DT_INST_PROP_OR(id, work_queue_cpu, -1),))
+
+#if IS_ENABLED(CONFIG_VALUE_SYNC_COUNTER)
+
+#define SYNC_COUNTER_CONFIG(id)						    \
+	IF_ENABLED(DT_INST_NODE_HAS_PROP(id, counter),			    \
+		   (.counter = DEVICE_DT_GET(DT_INST_PHANDLE(id, counter)), \
+		    .counter_period = DT_INST_PROP(id, period_us),	    \
+		    .counter_isr =					    \
+			    DT_INST_ENUM_IDX(id, counter_context) == 0,))
+
+#else /* !IS_ENABLED(CONFIG_VALUE_SYNC_COUNTER) */
+
+#define SYNC_COUNTER_CONFIG(id)
+
+#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_COUNTER) */
+
+#define SYNC_COUNTER_CHECK(id)							\
+	BUILD_ASSERT(!DT_INST_NODE_HAS_PROP(id, counter) ||			\
+		     IS_ENABLED(CONFIG_VALUE_SYNC_COUNTER),			\
+		     "counter driven sync requires CONFIG_VALUE_SYNC_COUNTER");	\
+	BUILD_ASSERT(!DT_INST_NODE_HAS_PROP(id, counter) ||			\
+		     DT_INST_NODE_HAS_PROP(id, period_us),			\
+		     "counter driven sync requires period-us property");
+
+#define SYNC_DEVICE(id)						    \
+								    \
+	SYNC_INST_GROUPS(id, SYNC_GROUP_DEFINE)			    \
+								    \
+	static const struct sync_group sync_groups_##id[] = {	    \
+		SYNC_INST_GROUPS(id, SYNC_GROUP)		    \
+	};							    \
+								    \
+	BUILD_ASSERT(ARRAY_SIZE(sync_groups_##id) > 0,		    \
+		     "sync should have values or groups");	    \
+								    \
+	SYNC_COUNTER_CHECK(id)					    \
+								    \
+	SYNC_QUEUE_DEFINE(id)					    \
+								    \
+	static struct sync_data sync_data_##id = {		    \
+		.dev = DEVICE_DT_GET(DT_DRV_INST(id)),		    \
+	};							    \
+								    \
+	static const struct sync_config sync_config_##id = {	    \
+		.groups = sync_groups_##id,			    \
+		SYNC_QUEUE_CONFIG(id)				    \
+		SYNC_COUNTER_CONFIG(id)				    \
+		.num_groups = ARRAY_SIZE(sync_groups_##id),	    \
+		.sync_period = DT_INST_PROP_OR(id, period, 1000),   \
+		.overrun = DT_INST_ENUM_IDX(id, overrun_policy),    \
+		.initial_active = DT_INST_PROP(id, initial_active), \
+	};							    \
+								    \
+	DEVICE_DT_INST_DEFINE(id, sync_init, NULL, &sync_data_##id, \
+			      &sync_config_##id, POST_KERNEL,	    \
 			      CONFIG_VALUE_SYNC_INIT_PRIORITY, &sync_api);
 
 DT_INST_FOREACH_STATUS_OKAY(SYNC_DEVICE)
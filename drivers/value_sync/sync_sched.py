@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2023 MBT
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Value synchronization scheduler generator.
+
+Walks the `values` phandle-arrays of the device-tree nodes to build the
+graph of values producers and consumers, sorts it topologically and emits
+the order in which each `value-sync` instance should synchronize its values,
+so producers always synchronized before their consumers.
+
+Dependency cycles are rejected. Duplicated values are synchronized once.
+
+The generated header contains a macro per `value-sync` node and per
+each of its group child nodes which has values:
+
+    #define VALUE_SYNC_SCHED_ORD_<dep-ordinal> <idx>, <idx>, ...
+
+where each index refers to the entry of the `values` property of node.
+"""
+
+import argparse
+import os
+import pickle
+import sys
+
+SYNC_COMPAT = "value-sync"
+VALUES_PROP = "values"
+
+
+def values_of(node):
+    """Get (controller, value_id) pairs from the values property of node"""
+    prop = node.props.get(VALUES_PROP)
+    if prop is None or prop.type != "phandle-array":
+        return []
+    return [(entry.controller, tuple(entry.data.values()))
+            for entry in prop.val if entry is not None]
+
+
+def is_sync(node):
+    """Check that node is a synchronizer or a synchronization group"""
+    return SYNC_COMPAT in node.compats or \
+        (node.parent is not None and SYNC_COMPAT in node.parent.compats)
+
+
+def value_depths(nodes):
+    """
+    Calculate the depth of each node in the value graph.
+
+    The depth of node which does not consume any values is zero,
+    the depth of consumer is greater than the depths of its producers.
+    """
+    depths = {}
+    visiting = []
+
+    def visit(node):
+        if node in depths:
+            return depths[node]
+        if node in visiting:
+            cycle = visiting[visiting.index(node):] + [node]
+            sys.exit("value sync: dependency cycle detected: " +
+                     " -> ".join(n.path for n in cycle))
+
+        visiting.append(node)
+        depth = 0
+        if not is_sync(node):
+            for producer, _ in values_of(node):
+                if producer.status == "okay":
+                    depth = max(depth, visit(producer) + 1)
+        visiting.pop()
+
+        depths[node] = depth
+        return depth
+
+    for node in nodes:
+        visit(node)
+
+    return depths
+
+
+def sync_order(node, depths):
+    """Get the indexes of values of sync node ordered by dependencies"""
+    values = values_of(node)
+    order = []
+    seen = set()
+
+    for idx, (producer, cells) in enumerate(values):
+        key = (producer.path, cells)
+        if key in seen:
+            # synchronize the same value only once
+            continue
+        seen.add(key)
+        order.append(idx)
+
+    # stable sort keeps the configured order of independent values
+    return sorted(order, key=lambda idx: depths.get(values[idx][0], 0))
+
+
+def write_header(out, syncs, depths):
+    out.write("/*\n"
+              " * Generated by sync_sched.py, do not edit.\n"
+              " */\n\n"
+              "#ifndef VALUE_SYNC_SCHED_H_\n"
+              "#define VALUE_SYNC_SCHED_H_\n")
+
+    for node in syncs:
+        order = sync_order(node, depths)
+        values = values_of(node)
+
+        out.write(f"\n/* {node.path}: " +
+                  ", ".join(values[idx][0].path for idx in order) + " */\n")
+        out.write(f"#define VALUE_SYNC_SCHED_ORD_{node.dep_ordinal} " +
+                  ", ".join(str(idx) for idx in order) + "\n")
+
+    out.write("\n#endif /* VALUE_SYNC_SCHED_H_ */\n")
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--zephyr-base", default=os.environ.get("ZEPHYR_BASE"),
+                        help="Zephyr base directory (for devicetree package)")
+    parser.add_argument("--edt-pickle", required=True,
+                        help="Path to pickled edtlib.EDT object")
+    parser.add_argument("--header-out", required=True,
+                        help="Path to write generated header to")
+    return parser.parse_args()
+
+
+def main():
+    args = parse_args()
+
+    if args.zephyr_base:
+        sys.path.insert(0, os.path.join(args.zephyr_base, "scripts", "dts",
+                                        "python-devicetree", "src"))
+
+    with open(args.edt_pickle, "rb") as f:
+        edt = pickle.load(f)
+
+    nodes = [node for node in edt.nodes if node.status == "okay"]
+    depths = value_depths(nodes)
+    syncs = [node for node in nodes if is_sync(node) and values_of(node)]
+
+    with open(args.header_out, "w", encoding="utf-8") as out:
+        write_header(out, syncs, depths)
+
+
+if __name__ == "__main__":
+    main()
@@ -28,6 +28,8 @@ static int cmd_list(const struct shell *shell, size_t argc, char **argv)
 	const struct device *dev;
 	size_t i;
 	value_t state;
+	value_t missed;
+	value_t late_ticks;
 
 #if IS_ENABLED(CONFIG_VALUE_SYNC_TIMING)
 	value_t min_cycles;
@@ -42,6 +44,8 @@ static int cmd_list(const struct shell *shell, size_t argc, char **argv)
 		dev = device_ptr[i];
 
 		value_get(dev, SYNC_STATE, &state);
+		value_get(dev, SYNC_MISSED, &missed);
+		value_get(dev, SYNC_LATE_TICKS, &late_ticks);
 #if IS_ENABLED(CONFIG_VALUE_SYNC_TIMING)
 		value_get(dev, SYNC_MIN_CYCLES, &min_cycles);
 		value_get(dev, SYNC_MAX_CYCLES, &max_cycles);
@@ -49,14 +53,15 @@ static int cmd_list(const struct shell *shell, size_t argc, char **argv)
 
 #if IS_ENABLED(CONFIG_VALUE_SYNC_TIMING)
 		shell_print(shell,
-			    "[%i] %s: %s (timing [cycles]: min=%d (%d nS), max=%d (%d nS))",
-			    i, dev->name, state ? "on" : "off",
+			    "[%i] %s: %s (missed=%d, late=%d ticks, "
+			    "timing [cycles]: min=%d (%d nS), max=%d (%d nS))",
+			    i, dev->name, state ? "on" : "off", missed, late_ticks,
 			    min_cycles, (uint32_t)timing_cycles_to_ns(min_cycles),
 			    max_cycles, (uint32_t)timing_cycles_to_ns(max_cycles));
 #else /* IS_ENABLED(CONFIG_VALUE_SYNC_TIMING) */
 		shell_print(shell,
-			    "[%i] %s: %s",
-			    i, dev->name, state ? "on" : "off");
+			    "[%i] %s: %s (missed=%d, late=%d ticks)",
+			    i, dev->name, state ? "on" : "off", missed, late_ticks);
 #endif /* IS_ENABLED(CONFIG_VALUE_SYNC_TIMING) */
 	}
 	return 0;
@@ -114,6 +119,87 @@ static int cmd_state(const struct shell *shell, size_t argc, char **argv)
 	return rc;
 }
 
+static int cmd_reset(const struct shell *shell, size_t argc, char **argv)
+{
+	const struct device *dev;
+	int rc;
+
+	rc = parse_common_args(shell, argv);
+	if (rc < 0) {
+		return rc;
+	}
+	dev = device_ptr[rc];
+
+	rc = value_set(dev, SYNC_RESET, 0);
+	if (rc < 0) {
+		shell_print(shell, "%s: Error when resetting statistics", dev->name);
+	} else {
+		shell_print(shell, "%s: Statistics reset", dev->name);
+	}
+
+	return rc;
+}
+
+#if IS_ENABLED(CONFIG_VALUE_SYNC_TIMING)
+static int cmd_stats(const struct shell *shell, size_t argc, char **argv)
+{
+	const struct device *dev;
+	int rc;
+	size_t i;
+	value_t val;
+	value_t num_targets;
+	value_t total;
+	value_t max_cycles;
+	int64_t sum = 0;
+
+	rc = parse_common_args(shell, argv);
+	if (rc < 0) {
+		return rc;
+	}
+	dev = device_ptr[rc];
+
+	value_get(dev, SYNC_MIN_JITTER, &val);
+	shell_fprintf(shell, SHELL_NORMAL, "%s: jitter [uS]: min=%d", dev->name, val);
+	value_get(dev, SYNC_MAX_JITTER, &val);
+	shell_fprintf(shell, SHELL_NORMAL, ", max=%d\n", val);
+
+	shell_print(shell, "histogram [cycles]:");
+	for (i = 0; i < CONFIG_VALUE_SYNC_TIMING_HIST_BINS; i++) {
+		value_get(dev, SYNC_HIST(i), &val);
+		if (val == 0) {
+			continue;
+		}
+		if (i < CONFIG_VALUE_SYNC_TIMING_HIST_BINS - 1) {
+			shell_print(shell, "  %10u..%-10u: %d",
+				    i > 0 ? 1U << i : 0, (2U << i) - 1, val);
+		} else {
+			shell_print(shell, "  %10u..%-10s: %d", 1U << i, "", val);
+		}
+	}
+
+	rc = value_get(dev, SYNC_NUM_TARGETS, &num_targets);
+	if (rc < 0) {
+		return rc;
+	}
+
+	for (i = 0; i < num_targets; i++) {
+		value_get(dev, SYNC_TARGET_TOTAL(i), &total);
+		sum += total;
+	}
+
+	shell_print(shell, "values [cycles]:");
+	for (i = 0; i < num_targets; i++) {
+		value_get(dev, SYNC_TARGET_TOTAL(i), &total);
+		value_get(dev, SYNC_TARGET_MAX(i), &max_cycles);
+		shell_print(shell, "  [%zu] total=%dk (%d%%), max=%d (%d nS)",
+			    i, total, sum > 0 ? (int)((int64_t)total * 100 / sum) : 0,
+			    max_cycles, (uint32_t)timing_cycles_to_ns(max_cycles));
+	}
+
+	return 0;
+}
+#endif /* IS_ENABLED(CONFIG_VALUE_SYNC_TIMING) */
+
 static void dev_name_get(size_t idx, struct shell_static_entry *entry)
 {
 	entry->syntax = idx < num_devices ? device_ptr[idx]->name : NULL;
@@ -129,6 +215,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 	SHELL_CMD_ARG(list, NULL, "Show available sync devices", cmd_list, 1, 0),
 	SHELL_CMD_ARG(on, &dev_name, "<device> Enable sync", cmd_state, 2, 0),
 	SHELL_CMD_ARG(off, &dev_name, "<device> Disable sync", cmd_state, 2, 0),
+	SHELL_COND_CMD_ARG(CONFIG_VALUE_SYNC_TIMING, stats, &dev_name,
+			   "<device> Show timing statistics", cmd_stats, 2, 0),
+	SHELL_CMD_ARG(reset, &dev_name, "<device> Reset statistics", cmd_reset, 2, 0),
 	SHELL_SUBCMD_SET_END);
 
 SHELL_CMD_REGISTER(valsync, &sub_valsync, "Value sync commands", NULL);
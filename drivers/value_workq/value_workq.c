@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2023 MBT
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/drivers/value_workq.h>
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(value_workq, CONFIG_VALUE_WORKQ_LOG_LEVEL);
+
+K_KERNEL_STACK_DEFINE(value_workq_stack, CONFIG_VALUE_WORKQ_STACK_SIZE);
+
+struct k_work_q value_workq;
+
+static int value_workq_init(void)
+{
+	int rc;
+
+	rc = value_workq_start(&value_workq, value_workq_stack,
+			       K_KERNEL_STACK_SIZEOF(value_workq_stack),
+			       CONFIG_VALUE_WORKQ_PRIORITY,
+			       CONFIG_VALUE_WORKQ_CPU,
+			       "value_workq");
+	if (rc < 0) {
+		LOG_WRN("Unable to pin work queue to CPU%d: %d",
+			CONFIG_VALUE_WORKQ_CPU, rc);
+	}
+
+	return 0;
+}
+
+SYS_INIT(value_workq_init, POST_KERNEL, CONFIG_VALUE_WORKQ_INIT_PRIORITY);
@@ -101,6 +101,30 @@ typedef int (*value_api_set)(const struct device *dev,
 			     value_id_t id,
 			     value_t val);
 
+/**
+ * @typedef value_api_get_many()
+ * @brief Callback API for getting multiple output values by identifiers
+ *
+ * @see value_get_many() for argument descriptions.
+ */
+typedef int (*value_api_get_many)(const struct device *dev,
+				  const value_id_t *ids,
+				  value_t *pvals,
+				  int *rcs,
+				  size_t num);
+
+/**
+ * @typedef value_api_set_many()
+ * @brief Callback API for setting multiple input values by identifiers
+ *
+ * @see value_set_many() for argument descriptions.
+ */
+typedef int (*value_api_set_many)(const struct device *dev,
+				  const value_id_t *ids,
+				  const value_t *vals,
+				  int *rcs,
+				  size_t num);
+
 struct value_sub_cb;
 
 /**
@@ -232,6 +256,8 @@ __subsystem struct value_driver_api {
 	value_api_get get;
 	value_api_set set;
 	value_api_sub sub;
+	value_api_get_many get_many;
+	value_api_set_many set_many;
 };
 
 /**
@@ -318,6 +344,192 @@ static inline int value_set_dt(const struct value_dt_spec *spec,
 	return value_set(spec->dev, spec->id, val);
 }
 
+/**
+ * @brief Maximum number of values requested from a device at once
+ *
+ * The value_get_many_dt() and value_set_many_dt() split the runs of
+ * specifiers which refers to the same device into batches of this size.
+ */
+#define VALUE_DT_MANY_BATCH 32
+
+/**
+ * @brief Get multiple output values
+ *
+ * This optional routine gets the output values by identifiers at once.
+ * When driver does not implement it the values will be got one by one.
+ *
+ * @param dev Output device
+ * @param ids Output identifiers
+ * @param pvals Pointer to values to get
+ * @param rcs Pointer to statuses for each value (0 on success, negative on error)
+ * @param num Number of values
+ * @return 0 when all values got successfully, otherwise the status of first failed value
+ */
+__syscall int value_get_many(const struct device *dev,
+			     const value_id_t *ids,
+			     value_t *pvals,
+			     int *rcs,
+			     size_t num);
+
+static inline int z_impl_value_get_many(const struct device *dev,
+					const value_id_t *ids,
+					value_t *pvals,
+					int *rcs,
+					size_t num)
+{
+	const struct value_driver_api *api =
+		(const struct value_driver_api *)dev->api;
+	size_t idx;
+	int rc = 0;
+
+	if (api->get_many != NULL) {
+		return api->get_many(dev, ids, pvals, rcs, num);
+	}
+
+	for (idx = 0; idx < num; idx++) {
+		rcs[idx] = api->get == NULL ? -ENOSYS :
+			   api->get(dev, ids[idx], &pvals[idx]);
+		if (rcs[idx] != 0 && rc == 0) {
+			rc = rcs[idx];
+		}
+	}
+
+	return rc;
+}
+
+/**
+ * @brief Get multiple output values
+ *
+ * This optional routine gets the output values by specifiers.
+ * The consecutive specifiers which refers to the same device
+ * will be requested using single call (up to VALUE_DT_MANY_BATCH).
+ * The specifiers are not regrouped by device, so the values are
+ * requested in the given order and the specifiers of the same device
+ * should be placed together to batch them.
+ *
+ * @param specs Value specifiers from device-tree
+ * @param pvals Pointer to values to get
+ * @param rcs Pointer to statuses for each value (0 on success, negative on error)
+ * @param num Number of values
+ * @return 0 when all values got successfully, otherwise the status of first failed value
+ */
+static inline int value_get_many_dt(const struct value_dt_spec *specs,
+				    value_t *pvals,
+				    int *rcs,
+				    size_t num)
+{
+	value_id_t ids[VALUE_DT_MANY_BATCH];
+	size_t idx;
+	size_t cnt;
+	int rc = 0;
+	int status;
+
+	for (idx = 0; idx < num; idx += cnt) {
+		/* collect identifiers of values which belongs to the same device */
+		for (cnt = 0; cnt < VALUE_DT_MANY_BATCH && idx + cnt < num &&
+		     specs[idx + cnt].dev == specs[idx].dev; cnt++) {
+			ids[cnt] = specs[idx + cnt].id;
+		}
+
+		status = value_get_many(specs[idx].dev, ids,
+					&pvals[idx], &rcs[idx], cnt);
+		if (status != 0 && rc == 0) {
+			rc = status;
+		}
+	}
+
+	return rc;
+}
+
+/**
+ * @brief Set multiple input values
+ *
+ * This optional routine sets the input values by identifiers at once.
+ * When driver does not implement it the values will be set one by one.
+ *
+ * @param dev Input device
+ * @param ids Input identifiers
+ * @param vals Actual values to set
+ * @param rcs Pointer to statuses for each value (0 on success, negative on error)
+ * @param num Number of values
+ * @return 0 when all values set successfully, otherwise the status of first failed value
+ */
+__syscall int value_set_many(const struct device *dev,
+			     const value_id_t *ids,
+			     const value_t *vals,
+			     int *rcs,
+			     size_t num);
+
+static inline int z_impl_value_set_many(const struct device *dev,
+					const value_id_t *ids,
+					const value_t *vals,
+					int *rcs,
+					size_t num)
+{
+	const struct value_driver_api *api =
+		(const struct value_driver_api *)dev->api;
+	size_t idx;
+	int rc = 0;
+
+	if (api->set_many != NULL) {
+		return api->set_many(dev, ids, vals, rcs, num);
+	}
+
+	for (idx = 0; idx < num; idx++) {
+		rcs[idx] = api->set == NULL ? -ENOSYS :
+			   api->set(dev, ids[idx], vals[idx]);
+		if (rcs[idx] != 0 && rc == 0) {
+			rc = rcs[idx];
+		}
+	}
+
+	return rc;
+}
+
+/**
+ * @brief Set multiple input values
+ *
+ * This optional routine sets the input values by specifiers.
+ * The consecutive specifiers which refers to the same device
+ * will be updated using single call (up to VALUE_DT_MANY_BATCH).
+ * The specifiers are not regrouped by device, so the values are
+ * updated in the given order and the specifiers of the same device
+ * should be placed together to batch them.
+ *
+ * @param specs Value specifiers from device-tree
+ * @param vals Actual values to set
+ * @param rcs Pointer to statuses for each value (0 on success, negative on error)
+ * @param num Number of values
+ * @return 0 when all values set successfully, otherwise the status of first failed value
+ */
+static inline int value_set_many_dt(const struct value_dt_spec *specs,
+				    const value_t *vals,
+				    int *rcs,
+				    size_t num)
+{
+	value_id_t ids[VALUE_DT_MANY_BATCH];
+	size_t idx;
+	size_t cnt;
+	int rc = 0;
+	int status;
+
+	for (idx = 0; idx < num; idx += cnt) {
+		/* collect identifiers of values which belongs to the same device */
+		for (cnt = 0; cnt < VALUE_DT_MANY_BATCH && idx + cnt < num &&
+		     specs[idx + cnt].dev == specs[idx].dev; cnt++) {
+			ids[cnt] = specs[idx + cnt].id;
+		}
+
+		status = value_set_many(specs[idx].dev, ids,
+					&vals[idx], &rcs[idx], cnt);
+		if (status != 0 && rc == 0) {
+			rc = status;
+		}
+	}
+
+	return rc;
+}
+
 /**
  * @brief Subscribe to value changes
  *
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2023 MBT
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Value drivers work queue
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_VALUE_WORKQ_H_
+#define ZEPHYR_INCLUDE_DRIVERS_VALUE_WORKQ_H_
+
+/**
+ * @brief Value Work Queue
+ * @defgroup value_workq Value Work Queue
+ * @ingroup value_interface
+ * @{
+ */
+
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if IS_ENABLED(CONFIG_VALUE_WORKQ)
+
+/**
+ * @brief Dedicated value work queue
+ */
+extern struct k_work_q value_workq;
+
+/**
+ * @brief Work queue to use by value drivers
+ */
+#define VALUE_WORKQ (&value_workq)
+
+#else /* !IS_ENABLED(CONFIG_VALUE_WORKQ) */
+
+#define VALUE_WORKQ (&k_sys_work_q)
+
+#endif /* IS_ENABLED(CONFIG_VALUE_WORKQ) */
+
+/**
+ * @brief Start work queue thread
+ *
+ * @param queue Work queue to start
+ * @param stack Stack of work queue thread
+ * @param stack_size Stack size of work queue thread
+ * @param prio Priority of work queue thread
+ * @param cpu CPU to pin work queue thread to (negative to run on any CPU)
+ * @param name Name of work queue thread
+ * @return 0 on success, negative on error
+ */
+static inline int value_workq_start(struct k_work_q *queue,
+				    k_thread_stack_t *stack,
+				    size_t stack_size,
+				    int prio, int cpu,
+				    const char *name)
+{
+	const struct k_work_queue_config cfg = {
+		.name = name,
+	};
+	int rc = 0;
+
+	k_work_queue_start(queue, stack, stack_size, prio, &cfg);
+
+#if IS_ENABLED(CONFIG_SCHED_CPU_MASK)
+	if (cpu >= 0) {
+		k_tid_t tid = k_work_queue_thread_get(queue);
+
+		/* thread must not be runnable when changing CPU mask */
+		k_thread_suspend(tid);
+		rc = k_thread_cpu_pin(tid, cpu);
+		k_thread_resume(tid);
+	}
+#else /* !IS_ENABLED(CONFIG_SCHED_CPU_MASK) */
+	if (cpu >= 0) {
+		rc = -ENOTSUP;
+	}
+#endif /* IS_ENABLED(CONFIG_SCHED_CPU_MASK) */
+
+	return rc;
+}
+
+/**
+ * @brief Submit work to value work queue
+ *
+ * @see k_work_submit()
+ */
+static inline int value_work_submit(struct k_work *work)
+{
+	return k_work_submit_to_queue(VALUE_WORKQ, work);
+}
+
+/**
+ * @brief Schedule delayable work in value work queue
+ *
+ * @see k_work_schedule()
+ */
+static inline int value_work_schedule(struct k_work_delayable *dwork,
+				      k_timeout_t delay)
+{
+	return k_work_schedule_for_queue(VALUE_WORKQ, dwork, delay);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_VALUE_WORKQ_H_ */
@@ -36,6 +36,48 @@
  */
 #define ADC_VALUES_NUM_CHANNELS 2
 
+/**
+ * @brief Number of samplings acquired in streaming mode
+ */
+#define ADC_VALUES_SAMPLINGS 3
+
+/**
+ * @brief Duration of the last scan in nanoseconds
+ */
+#define ADC_VALUES_SCAN_TIME 4
+
+/**
+ * @brief State of capture (ADC_VALUES_CAPTURE_IDLE, ...)
+ *
+ * Set to non-zero to arm capture, set to zero to stop it.
+ */
+#define ADC_VALUES_CAPTURE_STATE 5
+
+/**
+ * @brief Capture trigger
+ *
+ * Set to non-zero to trigger armed capture. Get to read the index of
+ * trigger scan in snapshot.
+ */
+#define ADC_VALUES_CAPTURE_TRIGGER 6
+
+/**
+ * @brief Number of scans in snapshot
+ */
+#define ADC_VALUES_CAPTURE_LENGTH 7
+
+/**
+ * @brief Number of halves of stream buffer lost in streaming mode
+ *
+ * The half is lost when it is overwritten before processed by thread.
+ */
+#define ADC_VALUES_STREAM_LOST 8
+
+#define ADC_VALUES_CAPTURE_IDLE 0
+#define ADC_VALUES_CAPTURE_ARMED 1
+#define ADC_VALUES_CAPTURE_TRIGGERED 2
+#define ADC_VALUES_CAPTURE_FROZEN 3
+
 #define ADC_VALUES_CHANNEL_FLAG (1 << 16)
 #define ADC_VALUES_CHANNEL_GET(id) ((id) &~ADC_VALUES_CHANNEL_FLAG)
 
@@ -44,6 +86,30 @@
  */
 #define ADC_VALUES_CHANNEL(n) ((n) | ADC_VALUES_CHANNEL_FLAG)
 
+#define ADC_VALUES_RING_FLAG (2 << 16)
+#define ADC_VALUES_IS_RING(id) (((id) & (3 << 16)) == ADC_VALUES_RING_FLAG)
+#define ADC_VALUES_RING_CHANNEL(id) ((id) & 0xff)
+#define ADC_VALUES_RING_AGE(id) (((id) >> 8) & 0xff)
+
+/**
+ * @brief Raw sample of channel kept in ring in streaming mode
+ *
+ * The age of the latest sample is 0, the previous is 1 and so on.
+ */
+#define ADC_VALUES_RING(n, age) (((age) << 8) | (n) | ADC_VALUES_RING_FLAG)
+
+#define ADC_VALUES_CAPTURE_FLAG (4 << 16)
+#define ADC_VALUES_IS_CAPTURE(id) (((id) & (7 << 16)) == ADC_VALUES_CAPTURE_FLAG)
+#define ADC_VALUES_CAPTURE_CHANNEL(id) ((id) & 0xff)
+#define ADC_VALUES_CAPTURE_INDEX(id) (((id) >> 8) & 0xff)
+
+/**
+ * @brief Raw sample of channel in frozen capture snapshot
+ *
+ * The index of the oldest scan is 0.
+ */
+#define ADC_VALUES_CAPTURE(n, idx) (((idx) << 8) | (n) | ADC_VALUES_CAPTURE_FLAG)
+
 /**
  * @}
  */
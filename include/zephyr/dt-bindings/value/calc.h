@@ -39,6 +39,14 @@
  */
 #define CALC_RESULTS (3 << 16)
 
+/**
+ * @brief The identifier for number of skipped operations
+ *
+ * The operations which arguments is not changed since previous sync
+ * is skipped. Can be set to reset the counter.
+ */
+#define CALC_SKIPPED (4 << 16)
+
 /**
  * @brief The identifier for results
  */
@@ -68,6 +68,48 @@
  */
 #define FILTER_VALUES (7 << 16)
 
+/**
+ * @brief Sequence number of published outputs (readonly)
+ *
+ * Incremented each time when outputs is updated (every Nth
+ * synchronization when decimation is used).
+ */
+#define FILTER_SEQUENCE (9 << 16)
+
+/**
+ * @brief Number of samples rejected as outliers
+ *
+ * Counted for all channels. Can be set to reset the counter.
+ */
+#define FILTER_REJECTED (10 << 16)
+
+/**
+ * @brief Parameter of single channel
+ *
+ * The parameter identifiers without channel (FILTER_ALPHA, ...) get
+ * the parameter of the first channel and set the parameter of all
+ * channels.
+ */
+#define FILTER_PARAM_CH(param, ch) ((param) | ((ch) + 1))
+
+#define FILTER_PARAM_ID(id) ((id) & ~0xffff)
+#define FILTER_PARAM_CHANNEL(id) ((id) & 0xffff)
+
+/**
+ * @brief Alpha parameter of channel
+ */
+#define FILTER_ALPHA_CH(ch) FILTER_PARAM_CH(FILTER_ALPHA, ch)
+
+/**
+ * @brief Samples parameter of channel
+ */
+#define FILTER_SAMPLES_CH(ch) FILTER_PARAM_CH(FILTER_SAMPLES, ch)
+
+/**
+ * @brief Time window parameter of channel
+ */
+#define FILTER_WINDOW_CH(ch) FILTER_PARAM_CH(FILTER_WINDOW, ch)
+
 /**
  * @brief Identifier to invoke command
  *
@@ -76,12 +118,14 @@
 #define FILTER_COMMAND (8 << 16)
 
 /**
- * @brief Load previously saved filter parameter from settings
+ * @brief Load previously saved filter parameters from settings
  */
 #define FILTER_PARAM_LOAD 1
 
 /**
- * @brief Save current value of filter parameter in settings
+ * @brief Save current values of filter parameters in settings
+ *
+ * The parameters of all channels are saved at once.
  */
 #define FILTER_PARAM_SAVE 2
 
@@ -92,6 +136,13 @@
  */
 #define FILTER_PARAM_RESET 3
 
+/**
+ * @brief Save current filter state in settings to warm start after reboot
+ *
+ * Should be invoked on shutdown. The values of all channels are saved at once.
+ */
+#define FILTER_STATE_SAVE 4
+
 /**
  * @}
  */
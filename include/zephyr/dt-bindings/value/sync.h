@@ -28,14 +28,82 @@
 
 /**
  * @brief Minimum cycles counted when timing
+ *
+ * When synchronization is triggered by counter the cycles are counted
+ * from counter interrupt to completion of synchronization.
  */
 #define SYNC_MIN_CYCLES 1
 
 /**
  * @brief Maximum cycles counted when timing
+ *
+ * When synchronization is triggered by counter the cycles are counted
+ * from counter interrupt to completion of synchronization.
  */
 #define SYNC_MAX_CYCLES 2
 
+/**
+ * @brief Number of missed deadlines
+ *
+ * The cycles which were dropped or coalesced, or with catch-up policy
+ * the cycles which were run after the deadline of the next cycle.
+ */
+#define SYNC_MISSED 3
+
+/**
+ * @brief Total number of ticks elapsed after deadlines
+ */
+#define SYNC_LATE_TICKS 4
+
+/**
+ * @brief Minimum wake-up jitter in microseconds when timing
+ *
+ * The jitter is the delay from deadline (or counter interrupt)
+ * to start of synchronization.
+ */
+#define SYNC_MIN_JITTER 5
+
+/**
+ * @brief Maximum wake-up jitter in microseconds when timing
+ */
+#define SYNC_MAX_JITTER 6
+
+/**
+ * @brief Reset statistics (set only)
+ */
+#define SYNC_RESET 7
+
+/**
+ * @brief Number of synchronized values (get only)
+ */
+#define SYNC_NUM_TARGETS 8
+
+/**
+ * @brief Mask of index in indexed values
+ */
+#define SYNC_INDEX_MASK 0xffff
+
+/**
+ * @brief Number of cycles which falls in histogram bin when timing
+ *
+ * The bin n counts cycles in range [2^n, 2^(n+1)), the last bin
+ * counts all greater cycles too.
+ */
+#define SYNC_HIST(bin) ((1 << 16) | (bin))
+
+/**
+ * @brief Total thousands of cycles spent to synchronize value when timing
+ *
+ * The values are numbered in order of synchronization
+ * (top-level values first, then values of groups).
+ */
+#define SYNC_TARGET_TOTAL(idx) ((2 << 16) | (idx))
+
+/**
+ * @brief Maximum cycles spent to synchronize value when timing
+ */
+#define SYNC_TARGET_MAX(idx) ((3 << 16) | (idx))
+
 /**
  * @}
  */
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2023 MBT
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/dt-bindings/value/filter.h>
+#include <zephyr/drivers/value.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/ztest.h>
+
+#define DT_DRV_COMPAT test_value_input
+
+#define NUM_VALUES DT_PROP_LEN(DT_NODELABEL(filter), values)
+
+/* number of measured synchronizations */
+#define NUM_PASSES 1000
+
+/* filter parameters (see overlay) */
+#define PARAM_SCALE (1 << 14)
+
+struct input_data {
+	value_t values[NUM_VALUES];
+};
+
+static int input_value_get(const struct device *dev, value_id_t id, value_t *pval)
+{
+	struct input_data *data = dev->data;
+
+	if (id >= NUM_VALUES) {
+		return -EINVAL;
+	}
+
+	*pval = data->values[id];
+
+	return 0;
+}
+
+static const struct value_driver_api input_api = {
+	.get = input_value_get,
+};
+
+static struct input_data input_data;
+
+DEVICE_DT_INST_DEFINE(0, NULL, NULL, &input_data, NULL, POST_KERNEL,
+		      CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &input_api);
+
+static const struct device *const filter = DEVICE_DT_GET(DT_NODELABEL(filter));
+
+/* pseudo-random inputs (LCG), so the results are reproducible */
+static value_t input_next(uint32_t *seed)
+{
+	*seed = *seed * 1664525 + 1013904223;
+
+	return (value_t)(*seed >> 12) - (1 << 19);
+}
+
+ZTEST(value_filter_benchmark, test_ema_pass)
+{
+	value_t expected[NUM_VALUES] = { 0 };
+	value_t alpha;
+	value_t output;
+	uint32_t seed = 1;
+	uint64_t cycles = 0;
+	timing_t start_time;
+	timing_t end_time;
+	unsigned pass;
+	unsigned idx;
+
+	zassert_ok(value_get(filter, FILTER_ALPHA, &alpha));
+
+	timing_init();
+	timing_start();
+
+	for (pass = 0; pass < NUM_PASSES; pass++) {
+		for (idx = 0; idx < NUM_VALUES; idx++) {
+			input_data.values[idx] = input_next(&seed);
+		}
+
+		start_time = timing_counter_get();
+		zassert_ok(value_set(filter, FILTER_SYNC, 0));
+		end_time = timing_counter_get();
+		cycles += timing_cycles_get(&start_time, &end_time);
+
+		/* reference EMA starting from the first input */
+		for (idx = 0; idx < NUM_VALUES; idx++) {
+			expected[idx] = pass == 0 ? input_data.values[idx] :
+					((int64_t)input_data.values[idx] * alpha +
+					 (int64_t)expected[idx] * (PARAM_SCALE - alpha)) /
+					PARAM_SCALE;
+
+			zassert_ok(value_get(filter, FILTER_OUTPUT(idx), &output));
+			zassert_equal(output, expected[idx], "pass %u value %u: %d != %d",
+				      pass, idx, output, expected[idx]);
+		}
+	}
+
+	timing_stop();
+
+	TC_PRINT("EMA pass of %u values: %llu cycles, %llu ns\n", NUM_VALUES,
+		 cycles / NUM_PASSES, timing_cycles_to_ns(cycles) / NUM_PASSES);
+}
+
+static void *value_filter_benchmark_setup(void)
+{
+	zassert_true(device_is_ready(filter), "filter is not ready");
+
+	return NULL;
+}
+
+ZTEST_SUITE(value_filter_benchmark, NULL, value_filter_benchmark_setup, NULL, NULL, NULL);
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2023 MBT
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/dt-bindings/value/sync.h>
+#include <zephyr/drivers/value.h>
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/ztest.h>
+#include <string.h>
+
+#define DT_DRV_COMPAT test_value_sync_target
+
+/* synchronizations run by each sync */
+#define TARGET_THREAD 0
+#define TARGET_ISR 1
+#define NUM_TARGETS 2
+
+/* counter period of both syncs (see overlay) */
+#define PERIOD_US 1000
+/* time to run sync in test */
+#define RUN_MS 100
+/* tolerance of counted synchronizations */
+#define SLACK 5
+
+struct target_data {
+	atomic_t cycles[NUM_TARGETS];
+	/* synchronizations run in interrupt */
+	atomic_t isr_cycles[NUM_TARGETS];
+	value_t period[NUM_TARGETS];
+	/* time to spend in each synchronization */
+	uint32_t busy_us;
+};
+
+static int target_value_get(const struct device *dev, value_id_t id, value_t *pval)
+{
+	struct target_data *data = dev->data;
+
+	if (id >= NUM_TARGETS) {
+		return -EINVAL;
+	}
+
+	*pval = atomic_get(&data->cycles[id]);
+
+	return 0;
+}
+
+static int target_value_set(const struct device *dev, value_id_t id, value_t val)
+{
+	struct target_data *data = dev->data;
+
+	if (id >= NUM_TARGETS) {
+		return -EINVAL;
+	}
+
+	atomic_inc(&data->cycles[id]);
+	if (k_is_in_isr()) {
+		atomic_inc(&data->isr_cycles[id]);
+	}
+	data->period[id] = val;
+
+	if (data->busy_us > 0) {
+		k_busy_wait(data->busy_us);
+	}
+
+	return 0;
+}
+
+static const struct value_driver_api target_api = {
+	.get = target_value_get,
+	.set = target_value_set,
+};
+
+static struct target_data target_data;
+
+DEVICE_DT_INST_DEFINE(0, NULL, NULL, &target_data, NULL, POST_KERNEL,
+		      CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &target_api);
+
+static const struct device *const target = DEVICE_DT_GET(DT_NODELABEL(sync_target));
+static const struct device *const sync_thread = DEVICE_DT_GET(DT_NODELABEL(sync_thread));
+static const struct device *const sync_isr = DEVICE_DT_GET(DT_NODELABEL(sync_isr));
+
+/* run sync for a while, get number of missed cycles */
+static value_t run_sync(const struct device *sync)
+{
+	value_t missed;
+
+	zassert_ok(value_set(sync, SYNC_STATE, 1));
+	k_sleep(K_MSEC(RUN_MS));
+	zassert_ok(value_set(sync, SYNC_STATE, 0));
+
+	zassert_ok(value_get(sync, SYNC_MISSED, &missed));
+
+	return missed;
+}
+
+ZTEST(value_sync_counter, test_thread)
+{
+	value_t missed = run_sync(sync_thread);
+	value_t cycles = atomic_get(&target_data.cycles[TARGET_THREAD]);
+
+	zassert_within(cycles, RUN_MS * 1000 / PERIOD_US, SLACK,
+		       "unexpected number of cycles: %d", cycles);
+	zassert_equal(missed, 0, "cycles missed without overrun: %d", missed);
+	zassert_equal(atomic_get(&target_data.isr_cycles[TARGET_THREAD]), 0,
+		      "thread sync run in interrupt");
+	zassert_equal(target_data.period[TARGET_THREAD], PERIOD_US);
+	zassert_equal(atomic_get(&target_data.cycles[TARGET_ISR]), 0);
+}
+
+ZTEST(value_sync_counter, test_thread_missed)
+{
+	value_t missed;
+	value_t cycles;
+
+	/* each cycle lasts more than two periods, so the next interrupt
+	 * comes while cycle is running
+	 */
+	target_data.busy_us = PERIOD_US * 5 / 2;
+
+	missed = run_sync(sync_thread);
+	cycles = atomic_get(&target_data.cycles[TARGET_THREAD]);
+
+	/* each interrupt either runs cycle or is missed */
+	zassert_true(missed > 0, "overrun is not counted");
+	zassert_within(cycles + missed, RUN_MS * 1000 / PERIOD_US, SLACK,
+		       "unexpected number of cycles: %d, missed: %d", cycles, missed);
+}
+
+ZTEST(value_sync_counter, test_isr)
+{
+	value_t missed = run_sync(sync_isr);
+	value_t cycles = atomic_get(&target_data.cycles[TARGET_ISR]);
+
+	zassert_within(cycles, RUN_MS * 1000 / PERIOD_US, SLACK,
+		       "unexpected number of cycles: %d", cycles);
+	zassert_equal(missed, 0, "cycles missed in interrupt: %d", missed);
+	zassert_equal(atomic_get(&target_data.isr_cycles[TARGET_ISR]), cycles,
+		      "isr sync run in thread");
+	zassert_equal(target_data.period[TARGET_ISR], PERIOD_US);
+	zassert_equal(atomic_get(&target_data.cycles[TARGET_THREAD]), 0);
+}
+
+static void value_sync_counter_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	memset(&target_data, 0, sizeof(target_data));
+
+	zassert_ok(value_set(sync_thread, SYNC_RESET, 0));
+	zassert_ok(value_set(sync_isr, SYNC_RESET, 0));
+}
+
+static void *value_sync_counter_setup(void)
+{
+	zassert_true(device_is_ready(target));
+	zassert_true(device_is_ready(sync_thread), "sync is not ready");
+	zassert_true(device_is_ready(sync_isr), "sync is not ready");
+
+	return NULL;
+}
+
+ZTEST_SUITE(value_sync_counter, NULL, value_sync_counter_setup,
+	    value_sync_counter_before, NULL, NULL);